@@ -29,6 +29,18 @@
 /* custom ARRAY_SIZE to avoid redefinition warning if thingset.h is included before Zephr headers */
 #define _ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
 #endif
+
+/*
+ * Decimals of float data objects, checked at build time. A static assertion cannot be used in
+ * an initializer, so an array with negative size causes the error for unsupported values.
+ */
+#define _THINGSET_F32_DECIMALS(decimals) \
+    ((decimals) \
+     + (int)(0 \
+             * sizeof(char[(decimals) >= THINGSET_DECIMALS_SHORTEST \
+                                   && (decimals) <= THINGSET_DECIMALS_MAX \
+                               ? 1 \
+                               : -1])))
 /** @endcond */
 
 #ifdef __cplusplus
@@ -82,6 +94,7 @@ extern "C" {
 
 /* Internal status codes */
 #define THINGSET_ERR_DESERIALIZATION_FINISHED 0xF0 /**< Internal indication: Parsing finished. */
+#define THINGSET_ERR_RESPONSE_CONTINUED       0xF1 /**< Internal indication: Response split. */
 
 #define THINGSET_ERROR(code) (code >= 0xA0) /**< Check if provided code indicates an error. */
 #define THINGSET_SUCCESS(code) \
@@ -94,8 +107,11 @@ extern "C" {
 #define THINGSET_ID_PATHS       0x17 /**< `_Paths` overlay */
 #define THINGSET_ID_METADATAURL 0x18 /**< URL for extended metadata information: `cMetadataURL` */
 #define THINGSET_ID_METADATA    0x19 /**< `_Metadata` overlay */
+#define THINGSET_ID_CHANGES     0x1A /**< `_Changes` overlay */
 #define THINGSET_ID_NODEID      0x1D /**< String containing the node ID: `cNodeID` */
 
+#define THINGSET_NUM_SUBSETS 7 /**< Number of subset flags available for each data object */
+
 /*
  * Macros for defining data object array elements.
  */
@@ -242,13 +258,15 @@ extern "C" {
  * @param id ID of this data object
  * @param name String literal with the data object name
  * @param float_ptr Pointer to the `float` variable
- * @param decimals Number of decimal digits to be serialized in text mode
+ * @param decimals Number of decimal digits to be serialized in text mode (max. 9) or
+ *                 #THINGSET_DECIMALS_SHORTEST
  * @param access Flags to define read/write access for this data object
  * @param subsets Subset(s) this data object belongs to
  */
 #define THINGSET_ITEM_FLOAT(parent_id, id, name, float_ptr, decimals, access, subsets) \
     { \
-        parent_id, id, name, { .f32 = float_ptr }, THINGSET_TYPE_F32, decimals, access, subsets \
+        parent_id, id, name, { .f32 = float_ptr }, THINGSET_TYPE_F32, \
+            _THINGSET_F32_DECIMALS(decimals), access, subsets \
     }
 
 /**
@@ -565,12 +583,13 @@ extern "C" {
  * @param name String literal with the data object name
  * @param struct_type Type of the struct used for the records (e.g. `struct my_record`)
  * @param struct_member Struct member of type `float` used for this item
- * @param decimals Number of decimal digits to be serialized in text mode
+ * @param decimals Number of decimal digits to be serialized in text mode (max. 9) or
+ *                 #THINGSET_DECIMALS_SHORTEST
  */
 #define THINGSET_RECORD_ITEM_FLOAT(parent_id, id, name, struct_type, struct_member, decimals) \
     { \
         parent_id, id, name, { .offset = offsetof(struct_type, struct_member) }, \
-            THINGSET_TYPE_F32, decimals, THINGSET_READ_MASK \
+            THINGSET_TYPE_F32, _THINGSET_F32_DECIMALS(decimals), THINGSET_READ_MASK \
     }
 
 /**
@@ -1049,13 +1068,15 @@ extern "C" {
  * Define a struct thingset_array to expose `float` arrays with #THINGSET_ITEM_ARRAY
  *
  * @param var_name Name of the created struct thingset_array variable
- * @param decimals Number of decimal digits to be serialized in text mode
+ * @param decimals Number of decimal digits to be serialized in text mode (max. 9) or
+ *                 #THINGSET_DECIMALS_SHORTEST
  * @param array Existing fixed-size array of type `float` (must be an array and not a pointer)
  * @param used_elements Currently used elements in the array
  */
 #define THINGSET_DEFINE_FLOAT_ARRAY(var_name, decimals, array, used_elements) \
     struct thingset_array var_name = { \
-        { .f32 = array }, THINGSET_TYPE_F32, decimals, _ARRAY_SIZE(array), used_elements, \
+        { .f32 = array }, THINGSET_TYPE_F32, _THINGSET_F32_DECIMALS(decimals), \
+        _ARRAY_SIZE(array), used_elements, \
     };
 
 /**
@@ -1219,7 +1240,8 @@ extern "C" {
  * Define a struct thingset_array to expose `float` arrays with #THINGSET_RECORD_ITEM_ARRAY
  *
  * @param var_name Name of the created struct thingset_array variable
- * @param decimals Number of decimal digits to be serialized in text mode
+ * @param decimals Number of decimal digits to be serialized in text mode (max. 9) or
+ *                 #THINGSET_DECIMALS_SHORTEST
  * @param struct_type Type of the struct used for the records (e.g. `struct my_record`)
  * @param struct_member Struct member of type `float` array used for this item
  */
@@ -1227,7 +1249,7 @@ extern "C" {
     struct thingset_array var_name = { \
         { .offset = offsetof(struct_type, struct_member) }, \
         THINGSET_TYPE_F32, \
-        decimals, \
+        _THINGSET_F32_DECIMALS(decimals), \
         _ARRAY_SIZE(((struct_type *)0)->struct_member), \
         _ARRAY_SIZE(((struct_type *)0)->struct_member), \
     };
@@ -1293,6 +1315,17 @@ extern "C" {
  */
 #define THINGSET_NO_CALLBACK NULL /**< No callback assigned to group */
 
+/**
+ * Decimals of float data objects to serialize in text mode with the shortest representation that
+ * is parsed as the same value again (max. 9 decimals)
+ */
+#define THINGSET_DECIMALS_SHORTEST -1
+
+/**
+ * Maximum number of decimals of float data objects supported in text mode
+ */
+#define THINGSET_DECIMALS_MAX 9
+
 /** @cond INTERNAL_HIDDEN */
 #define THINGSET_DETAIL_DYN_RECORDS -1
 /** @endcond */
@@ -1450,6 +1483,8 @@ enum thingset_data_format
     THINGSET_BIN_NAMES_VALUES, /**< Binary names and values (CBOR) */
     THINGSET_BIN_IDS_ONLY,     /**< Binary IDs only (CBOR) */
     THINGSET_BIN_VALUES_ONLY,  /**< Binary values only (CBOR) */
+    /** Binary IDs and values with maximum-width encoding of numbers (CBOR, reports only) */
+    THINGSET_BIN_IDS_VALUES_FIXED_WIDTH,
 };
 
 /**
@@ -1522,7 +1557,8 @@ struct thingset_data_object
     /**
      * Variable storing different detail information depending on the data type
      *
-     * - FLOAT32: Decimal digits (precision) to use during serialization to JSON.
+     * - FLOAT32: Decimal digits (precision) to use during serialization to JSON (max. 9) or
+     *   THINGSET_DECIMALS_SHORTEST.
      *
      * - DECFRAC: Exponent for conversion between internal unit and unit exposed via ThingSet
      *   (equivalent to decimal digits for FLOAT32).
@@ -1542,11 +1578,14 @@ struct thingset_data_object
     /**
      * Flags to assign data item to different data item subsets (e.g. for reports)
      */
-    MAYBE_CONST uint32_t subsets : 7;
+    MAYBE_CONST uint32_t subsets : THINGSET_NUM_SUBSETS;
 
 #ifdef CONFIG_THINGSET_OBJECT_LOOKUP_MAP
     /**
      * Pointer to next node in list for map lookup
+     *
+     * Not used anymore, as the lookup map is stored in the ThingSet context. Only kept to
+     * preserve the layout of this struct for existing applications.
      */
     sys_snode_t node;
 #endif /* CONFIG_THINGSET_OBJECT_LOOKUP_MAP */
@@ -1565,6 +1604,93 @@ struct thingset_endpoint
     bool use_ids;
 };
 
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+/**
+ * Entry of the endpoint cache, mapping a path to the resolved endpoint
+ */
+struct thingset_endpoint_cache_entry
+{
+    /** Resolved endpoint */
+    struct thingset_endpoint endpoint;
+    /** Hash of the path */
+    uint32_t hash;
+    /** Length of the path (0 if the entry is unused) */
+    uint8_t path_len;
+    /** Path (not null-terminated) */
+    char path[CONFIG_THINGSET_ENDPOINT_CACHE_PATH_LEN];
+};
+#endif /* CONFIG_THINGSET_ENDPOINT_CACHE */
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+/**
+ * Function to be called by a sink to pass serialized data to the application.
+ *
+ * @param data Pointer to the serialized data
+ * @param len Length of the data
+ * @param user_data User data as provided in struct thingset_sink
+ *
+ * @return 0 for success or negative error code to abort the serialization
+ */
+typedef int (*thingset_sink_flush_t)(const uint8_t *data, size_t len, void *user_data);
+
+/**
+ * Sink for streaming serialized data in chunks limited by the size of a staging buffer.
+ */
+struct thingset_sink
+{
+    /** Staging buffer for the data before it is flushed */
+    uint8_t *buf;
+    /** Size of the staging buffer */
+    size_t size;
+    /** Function called whenever the staging buffer is full and at the end of serialization */
+    thingset_sink_flush_t flush;
+    /** User data passed to the flush function */
+    void *user_data;
+};
+#endif /* CONFIG_THINGSET_STREAMING_SINK */
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+/**
+ * Function to be called by a source to read the data to be imported.
+ *
+ * @param buf Buffer to store the data
+ * @param len Maximum number of bytes to read
+ * @param user_data User data as provided in struct thingset_source
+ *
+ * @return Number of bytes read, 0 at the end of the data or negative error code to abort the
+ *         import
+ */
+typedef int (*thingset_source_read_t)(uint8_t *buf, size_t len, void *user_data);
+
+/**
+ * Source for importing data through a window buffer of limited size.
+ */
+struct thingset_source
+{
+    /** Window buffer for the data read from the source */
+    uint8_t *buf;
+    /** Size of the window buffer */
+    size_t size;
+    /** Function called whenever more data is needed */
+    thingset_source_read_t read;
+    /** User data passed to the read function */
+    void *user_data;
+};
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+/**
+ * Segment of data exported for scatter-gather transmission.
+ */
+struct thingset_iovec
+{
+    /** Pointer to the data of the segment */
+    const uint8_t *base;
+    /** Length of the segment */
+    size_t len;
+};
+#endif /* CONFIG_THINGSET_EXPORT_IOVEC */
+
 /* Forward-declaration of internal ThingSet API struct (defined in thingset_internal.h) */
 struct thingset_api;
 
@@ -1582,9 +1708,107 @@ struct thingset_context
 
 #ifdef CONFIG_THINGSET_OBJECT_LOOKUP_MAP
     /**
-     * Array of linked lists: map for object ID lookup
+     * Open addressing hash table with indices of the data objects for lookup by ID
+     */
+    uint16_t data_objects_lookup[2 * CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Number of hash bits used for the lookup table (i.e. capacity is 2^bits)
+     */
+    uint8_t data_objects_lookup_bits;
+#endif
+
+#ifdef CONFIG_THINGSET_ID_INDEX
+    /**
+     * Indices of the data objects, sorted by their ID
      */
-    sys_slist_t data_objects_lookup[CONFIG_THINGSET_OBJECT_LOOKUP_BUCKETS];
+    uint16_t id_index[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+#endif
+
+#ifdef CONFIG_THINGSET_CHILD_INDEX
+    /**
+     * Indices of the data objects, stably sorted by their parent ID
+     */
+    uint16_t child_index[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Position of the first child of each data object in the child_index array
+     */
+    uint16_t child_offsets[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+#endif
+
+#ifdef CONFIG_THINGSET_NAME_INDEX
+    /**
+     * Open addressing hash table with indices of the data objects for lookup by parent and name
+     */
+    uint16_t name_lookup[2 * CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Lower 16 bits of the hash of parent ID and name of each data object
+     */
+    uint16_t name_hashes[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Length of the name of each data object (UINT8_MAX for longer names)
+     */
+    uint8_t name_lengths[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Number of hash bits used for the name lookup table (i.e. capacity is 2^bits)
+     */
+    uint8_t name_lookup_bits;
+#endif
+
+#ifdef CONFIG_THINGSET_PATH_INDEX
+    /**
+     * Open addressing hash table with indices of the data objects for lookup by full path
+     */
+    uint16_t path_lookup[2 * CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Index of the parent of each data object (UINT16_MAX for objects at root level)
+     */
+    uint16_t path_parents[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Length of the full path of each data object (UINT16_MAX if the path could not be
+     * determined)
+     */
+    uint16_t path_lengths[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Lower 16 bits of the hash of the full path of each data object
+     */
+    uint16_t path_hashes[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Number of hash bits used for the path lookup table (i.e. capacity is 2^bits)
+     */
+    uint8_t path_lookup_bits;
+#endif
+
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    /**
+     * IDs of the data objects (dense copy for fast scans)
+     */
+    uint16_t hot_ids[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Parent IDs of the data objects (dense copy for fast scans)
+     */
+    uint16_t hot_parent_ids[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Subset flags of the data objects (dense copy for fast scans)
+     */
+    uint8_t hot_subsets[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+#endif
+
+#ifdef CONFIG_THINGSET_INDEX_LAZY_BUILD
+    /**
+     * Indicates if the lookup indices were completely built (after first use)
+     */
+    atomic_t indices_built;
 #endif
 
     /**
@@ -1592,6 +1816,112 @@ struct thingset_context
      */
     size_t num_objects;
 
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+    /**
+     * Indices of the data objects belonging to each subset, grouped by subset flag and sorted
+     * by index within each group
+     */
+    uint16_t subset_members[CONFIG_THINGSET_SUBSET_INDEX_MAX_MEMBERS];
+
+    /**
+     * Position of the first member of each subset in the subset_members array (the last element
+     * stores the total number of entries)
+     */
+    uint16_t subset_offsets[THINGSET_NUM_SUBSETS + 1];
+
+    /**
+     * Indicates if the subset lists are consistent with the data objects and can be used
+     */
+    bool subset_index_valid;
+#endif
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    /**
+     * Counter incremented whenever the subsets of data objects are changed, used to detect
+     * outdated report templates
+     */
+    uint32_t subsets_generation;
+#endif
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    /**
+     * Serialize numbers and booleans with their maximum-width encoding (binary mode only)
+     */
+    bool bin_fixed_width;
+#endif
+
+#ifdef CONFIG_THINGSET_RECORD_FIELD_CACHE
+    /**
+     * Field lists of all records objects, each stored as the ID of the records object followed
+     * by the indices of its fields and terminated by UINT16_MAX
+     */
+    uint16_t record_fields[CONFIG_THINGSET_RECORD_FIELD_CACHE_SIZE];
+
+    /**
+     * Indicates if the record field cache contains the fields of all records objects
+     */
+    bool record_fields_valid;
+#endif
+
+#if defined(CONFIG_THINGSET_BINARY_KEY_CACHE) || defined(CONFIG_THINGSET_TEXT_KEY_CACHE)
+    /**
+     * Lengths of the names of the data objects (UINT8_MAX if too long to be cached)
+     */
+    uint8_t key_name_lengths[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Indicates if the cached keys are available for all data objects
+     */
+    bool key_cache_valid;
+#endif
+
+#ifdef CONFIG_THINGSET_BINARY_KEY_CACHE
+    /**
+     * CBOR encoded IDs of the data objects (1 to 3 bytes, length given by the header byte)
+     */
+    uint8_t bin_key_ids[CONFIG_THINGSET_INDEX_MAX_OBJECTS][3];
+#endif
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    /**
+     * Current data version, incremented whenever a data object is changed (starting at 1)
+     */
+    uint32_t data_version;
+
+    /**
+     * Data version of the last change of each data object
+     */
+    uint32_t object_versions[CONFIG_THINGSET_INDEX_MAX_OBJECTS];
+
+    /**
+     * Only data objects changed after this version are considered as subset members (0 to
+     * consider all data objects)
+     */
+    uint32_t changes_since;
+#endif
+
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+    /**
+     * Cache of most recently resolved paths
+     */
+    struct thingset_endpoint_cache_entry endpoint_cache[CONFIG_THINGSET_ENDPOINT_CACHE_SIZE];
+
+    /**
+     * Indices of the endpoint cache entries, ordered from most to least recently used
+     */
+    uint8_t endpoint_cache_order[CONFIG_THINGSET_ENDPOINT_CACHE_SIZE];
+
+    /**
+     * Number of paths resolved from the endpoint cache
+     */
+    uint32_t endpoint_cache_hits;
+
+    /**
+     * Number of paths that were not found in the endpoint cache
+     */
+    uint32_t endpoint_cache_misses;
+#endif
+
     /**
      * Semaphore to lock this context and avoid race conditions if the context may be used by
      * multiple threads in parallel.
@@ -1687,8 +2017,165 @@ struct thingset_context
      * Endpoint used for the current message
      */
     struct thingset_endpoint endpoint;
+
+#ifdef CONFIG_THINGSET_TEXT_MODE
+    /**
+     * Parent and grandparent objects opened by a progressive text mode export
+     */
+    struct thingset_data_object *export_ancestors[2];
+
+    /**
+     * Number of objects opened by a progressive text mode export
+     */
+    int export_depth;
+#endif
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    /**
+     * Sink receiving the serialized data if the response buffer is a staging buffer (NULL
+     * otherwise)
+     */
+    const struct thingset_sink *sink;
+
+    /**
+     * Number of bytes already passed to the sink
+     */
+    size_t sink_flushed;
+
+    /**
+     * Indicates that a report is streamed to the sink
+     */
+    bool sink_report;
+#endif
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+    /**
+     * Source of the data for a pull-based import (NULL if no such import is running)
+     */
+    const struct thingset_source *source;
+
+    /**
+     * Number of bytes currently stored in the window buffer of the source
+     */
+    size_t source_len;
+
+    /**
+     * Indicates that the read function of the source reached the end of the data
+     */
+    bool source_eof;
+#endif
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    /**
+     * Segments of a scatter-gather export (NULL if no such export is running)
+     */
+    struct thingset_iovec *iov;
+
+    /**
+     * Maximum number of segments
+     */
+    size_t iov_max;
+
+    /**
+     * Number of segments already stored
+     */
+    size_t iov_count;
+
+    /**
+     * Start of the data in the response buffer which is not yet part of a segment
+     */
+    const uint8_t *iov_pending;
+#endif
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    /**
+     * Type of the response to be continued with thingset_process_continue (0 if none)
+     */
+    uint8_t cont_type;
+
+    /**
+     * Request of the response to be continued
+     */
+    const uint8_t *cont_msg;
+
+    /**
+     * Length of the request of the response to be continued
+     */
+    size_t cont_msg_len;
+
+    /**
+     * Position of the next requested element in the payload of the request (JSON token in text
+     * mode, byte offset in binary mode)
+     */
+    size_t cont_msg_pos;
+
+    /**
+     * Number of requested elements remaining in the payload of the request (binary mode only)
+     */
+    size_t cont_msg_remaining;
+
+    /**
+     * Data object of the element to be serialized first in the next piece
+     */
+    const struct thingset_data_object *cont_object;
+
+    /**
+     * Iteration position of the children or record fields following cont_object
+     */
+    unsigned int cont_pos;
+
+    /**
+     * Length of the response in front of the element currently serialized
+     */
+    size_t cont_len;
+
+    /**
+     * Length of the current piece in front of its first element
+     */
+    size_t cont_start;
+
+    /**
+     * Number of elements in the map or list of the entire response
+     */
+    size_t cont_num;
+#endif
 };
 
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+/**
+ * Prepared report of a subset.
+ *
+ * Stores the static parts of a report (header and keys) together with the members of the
+ * subset, so that rendering the report only requires serializing the values.
+ *
+ * The template has to be initialized with thingset_report_prepare().
+ */
+struct thingset_report_template
+{
+    /** ThingSet context the template was prepared for */
+    struct thingset_context *ts;
+    /** Subset data object to be reported */
+    struct thingset_data_object *object;
+    /** Protocol data format of the report */
+    enum thingset_data_format format;
+    /** Subsets generation of the context the template was prepared for */
+    uint32_t generation;
+    /** Number of members of the subset */
+    uint16_t num_members;
+    /** Length of the report header stored at the beginning of the data buffer */
+    uint16_t header_len;
+    /** Indices of the subset members in the data objects array */
+    uint16_t members[CONFIG_THINGSET_REPORT_TEMPLATE_MAX_MEMBERS];
+    /**
+     * End of the static data preceding the value of each member in the data buffer (the last
+     * element stores the end of the data following the last value)
+     */
+    uint16_t segment_ends[CONFIG_THINGSET_REPORT_TEMPLATE_MAX_MEMBERS + 1];
+    /** Serialized header, keys and separators */
+    uint8_t data[CONFIG_THINGSET_REPORT_TEMPLATE_BUF_SIZE];
+};
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
 /**
  * Initialize a ThingSet context.
  *
@@ -1730,6 +2217,48 @@ void thingset_init_global(struct thingset_context *ts);
 int thingset_process_message(struct thingset_context *ts, const uint8_t *msg, size_t msg_len,
                              uint8_t *rsp, size_t rsp_size);
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+/**
+ * Retrieve the next piece of a response which did not fit into the response buffer.
+ *
+ * If the response to a GET request of a group or a record or to a FETCH request does not fit
+ * into the buffer passed to thingset_process_message, it is split between two elements of the
+ * returned map or list instead of returning an error. The first piece is returned by
+ * thingset_process_message and the following pieces have to be retrieved with this function
+ * until it returns 0. The concatenated pieces are equal to the response which would have been
+ * returned with a sufficiently large buffer.
+ *
+ * The buffer of the request passed to thingset_process_message must stay valid until the last
+ * piece was retrieved. The values are read when the piece containing them is serialized. A
+ * pending response is discarded if a new message is processed.
+ *
+ * In text mode, each piece is null-terminated, but the termination character is not included
+ * in the returned length.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param rsp Pointer to the buffer where the next piece of the response should be stored
+ * @param rsp_size Size of the response buffer
+ *
+ * @retval rsp_len Length of the piece of the response written to the buffer
+ * @retval 0 If there is no pending response (the previous piece was the last one)
+ * @retval err Negative ThingSet response code if the response could not be continued (e.g.
+ *             -THINGSET_ERR_RESPONSE_TOO_LARGE if a single element does not fit into the buffer)
+ */
+int thingset_process_continue(struct thingset_context *ts, uint8_t *rsp, size_t rsp_size);
+
+/**
+ * Check if the response of the last processed message has to be continued.
+ *
+ * @param ts Pointer to ThingSet context.
+ *
+ * @returns True if further pieces of the response have to be retrieved with
+ *          thingset_process_continue
+ */
+bool thingset_response_continued(struct thingset_context *ts);
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 /**
  * Retrieve data for given subset(s).
  *
@@ -1754,7 +2283,10 @@ int thingset_export_subsets(struct thingset_context *ts, uint8_t *buf, size_t bu
  * EXPERIMENTAL
  *
  * Exports object data for the given subset to the supplied buffer in the specified format starting
- * at the given object index. At present, only binary formats are supported.
+ * at the given object index. The text format and the binary format with IDs are supported.
+ *
+ * The concatenation of all chunks is identical to the data generated by
+ * thingset_export_subsets(). In text mode, only the last chunk is null-terminated.
  *
  * @param ts Pointer to ThingSet context.
  * @param buf Pointer to the buffer where the data should be stored
@@ -1867,6 +2399,35 @@ int thingset_import_data_progressively(struct thingset_context *ts, const uint8_
                                        enum thingset_data_format format, uint8_t auth_flags,
                                        uint32_t *last_id, size_t *consumed);
 
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+/**
+ * Import data pulled from a source into data objects.
+ *
+ * The data is read into the window buffer of the source and imported item by item. Consumed
+ * items are discarded, so that the RAM required for the import is bounded by the size of the
+ * window buffer. Each data item (key and value) must fit into the window buffer.
+ *
+ * In text mode and in binary mode with names, the keys of the top-level map may be names of
+ * root objects or paths, and maps as values of groups are imported recursively. In binary mode
+ * with IDs, a flat map of IDs and values is expected (see thingset_import_data()).
+ *
+ * Unknown data items are silently ignored.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param source Pointer to the source providing the data
+ * @param auth_flags Authentication flags to be used in this function (to override auth_flags)
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ *
+ * @returns 0 for success, negative ThingSet response code in case of error or the error code
+ *          returned by the read function
+ */
+int thingset_import_data_from_source(struct thingset_context *ts,
+                                     const struct thingset_source *source, uint8_t auth_flags,
+                                     enum thingset_data_format format);
+
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
 /**
  * Completes the import of data from the buffer passed to @ref
  * thingset_begin_import_data_progressively into data objects.
@@ -1899,8 +2460,8 @@ int thingset_import_record(struct thingset_context *ts, const uint8_t *data, siz
  *
  * @note Searching the object database to find the path and items to be published based on the
  * path provides the most user-friendly API, but is not the most efficient way to generate the
- * report. A more efficient method which caches the pointers to the data objects may be added
- * in the future.
+ * report. For subsets, thingset_report_prepare() and thingset_report_render() provide a more
+ * efficient method which caches the members and keys (see CONFIG_THINGSET_REPORT_TEMPLATES).
  *
  * The string in the buffer will be null-terminated, but the termination character is not included
  * in the returned length.
@@ -1916,6 +2477,295 @@ int thingset_import_record(struct thingset_context *ts, const uint8_t *data, siz
 int thingset_report_path(struct thingset_context *ts, char *buf, size_t buf_size, const char *path,
                          enum thingset_data_format format);
 
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+/**
+ * Prepare a report template for a subset.
+ *
+ * The report header, the members of the subset and their keys are serialized once into the
+ * template, so that subsequent reports can be generated with thingset_report_render() by
+ * serializing only the values.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param path Path of the subset to be published
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ * @param tmpl Pointer to the report template to be initialized
+ *
+ * @returns 0 for success or negative ThingSet response code in case of error
+ */
+int thingset_report_prepare(struct thingset_context *ts, const char *path,
+                            enum thingset_data_format format,
+                            struct thingset_report_template *tmpl);
+
+/**
+ * Generate a report from a prepared template.
+ *
+ * The result is identical to thingset_report_path() for the path and format used to prepare
+ * the template. If the subsets were changed since the template was prepared, the template is
+ * updated before generating the report.
+ *
+ * The string in the buffer will be null-terminated in text mode, but the termination character
+ * is not included in the returned length.
+ *
+ * @param tmpl Pointer to the report template
+ * @param buf Pointer to the buffer where the report should be stored
+ * @param buf_size Size of the buffer, i.e. maximum allowed length of the report
+ *
+ * @return Actual length of the report or negative ThingSet response code in case of error
+ */
+int thingset_report_render(struct thingset_report_template *tmpl, char *buf, size_t buf_size);
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+/**
+ * Update the values of a report previously rendered from a template.
+ *
+ * Only available for templates prepared with THINGSET_BIN_IDS_VALUES_FIXED_WIDTH format, as the
+ * position of the values in the report does not change. The buffer must contain the report
+ * generated by the last call of thingset_report_render() or thingset_report_patch() for the
+ * same template. If the subsets were changed in the meantime, the report is rendered again.
+ *
+ * @param tmpl Pointer to the report template
+ * @param buf Pointer to the buffer containing the previous report
+ * @param buf_size Size of the buffer, i.e. maximum allowed length of the report
+ *
+ * @return Actual length of the report or negative ThingSet response code in case of error
+ */
+int thingset_report_patch(struct thingset_report_template *tmpl, char *buf, size_t buf_size);
+
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
+
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+
+/**
+ * Retrieve data for given subset(s) and stream it to a sink.
+ *
+ * The data is serialized into the staging buffer of the sink, which is flushed whenever the next
+ * subset member does not fit into the remaining space. The last chunk is flushed before the
+ * function returns. In contrast to thingset_export_subsets(), the text mode data is not
+ * null-terminated.
+ *
+ * See thingset_export_subsets() for further details.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param sink Pointer to the sink receiving the data
+ * @param subsets Flags to select which subset(s) of data items should be exported
+ * @param format Protocol data format to be used (text or binary with IDs)
+ *
+ * @return Total length of the data passed to the sink, negative ThingSet response code in case
+ *         of error or the error code returned by the flush function
+ */
+int thingset_export_subsets_to_sink(struct thingset_context *ts, const struct thingset_sink *sink,
+                                    uint16_t subsets, enum thingset_data_format format);
+
+/**
+ * Generate a report for the given path and stream it to a sink.
+ *
+ * Reports of subsets are streamed member by member. Reports of other data objects (e.g. groups)
+ * have to fit entirely into the staging buffer of the sink.
+ *
+ * See thingset_report_path() for further details.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param sink Pointer to the sink receiving the report
+ * @param path Path to subset/group/record or single data object to be published
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ *
+ * @return Total length of the report passed to the sink, negative ThingSet response code in case
+ *         of error or the error code returned by the flush function
+ */
+int thingset_report_path_to_sink(struct thingset_context *ts, const struct thingset_sink *sink,
+                                 const char *path, enum thingset_data_format format);
+
+#endif /* CONFIG_THINGSET_STREAMING_SINK */
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+
+/**
+ * Retrieve data for given subset(s) as a list of segments for scatter-gather transmission.
+ *
+ * CBOR headers, keys and small values are serialized into the provided buffer. The content of
+ * strings and byte strings with at least CONFIG_THINGSET_EXPORT_IOVEC_MIN_LEN bytes is not
+ * copied, but referenced in place from the data objects. The concatenation of all segments is
+ * identical to the data generated by thingset_export_subsets().
+ *
+ * The referenced data objects must not be changed until the transmission is finished.
+ *
+ * Only the binary format with IDs is supported.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param buf Pointer to the buffer for the CBOR headers, keys and small values
+ * @param buf_size Size of the buffer
+ * @param iov Pointer to the array receiving the segments
+ * @param iov_max Maximum number of segments in the array
+ * @param subsets Flags to select which subset(s) of data items should be exported
+ * @param format Protocol data format to be used (binary with IDs only)
+ *
+ * @return Number of segments or negative ThingSet response code in case of error
+ */
+int thingset_export_subsets_iovec(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                                  struct thingset_iovec *iov, size_t iov_max, uint16_t subsets,
+                                  enum thingset_data_format format);
+
+#endif /* CONFIG_THINGSET_EXPORT_IOVEC */
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+/**
+ * Determine the length of the data for given subset(s) without storing it.
+ *
+ * The length is calculated from the current values without serializing the data, so it is not
+ * limited by any buffer size. The result is the length returned by thingset_export_subsets()
+ * for the current values. A buffer with one more byte is sufficient to serialize the data. The
+ * additional byte is needed for the null-termination in text mode and for the header of the
+ * outermost map or list in binary mode, which is reserved with its maximum size.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param subsets Flags to select which subset(s) of data items should be exported
+ * @param format Protocol data format to be used (text or binary with IDs)
+ *
+ * @return Length of the data or negative ThingSet response code in case of error
+ */
+int thingset_export_size(struct thingset_context *ts, uint16_t subsets,
+                         enum thingset_data_format format);
+
+/**
+ * Determine the length of a report for the given path without storing it.
+ *
+ * The length is calculated from the current values without serializing the data, calling the
+ * read callbacks of groups and records in the same way as thingset_report_path(). The result is
+ * the length returned by thingset_report_path() for the current values. A buffer with one more
+ * byte is sufficient to serialize the report (see thingset_export_size()).
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param path Path to subset/group/record or single data object to be published
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ *
+ * @return Length of the report or negative ThingSet response code in case of error
+ */
+int thingset_report_size(struct thingset_context *ts, const char *path,
+                         enum thingset_data_format format);
+
+/**
+ * Calculate the maximum length of the data for given subset(s), independent of the values.
+ *
+ * The bound is based on the types of the data objects, the size of strings and byte strings
+ * and the capacity of arrays and records. As it does not change at runtime, it is typically
+ * calculated once during initialization to allocate a sufficiently large buffer for
+ * thingset_export_subsets(), which has to be one byte larger than the returned bound (see
+ * thingset_export_size()).
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param subsets Flags to select which subset(s) of data items should be exported
+ * @param format Protocol data format to be used (text or binary with IDs)
+ *
+ * @return Maximum length of the data or negative ThingSet response code in case of error
+ */
+int thingset_export_size_max(struct thingset_context *ts, uint16_t subsets,
+                             enum thingset_data_format format);
+
+/**
+ * Calculate the maximum length of a report for the given path, independent of the values.
+ *
+ * See thingset_export_size_max() for further details.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param path Path to subset/group/record or single data object to be published
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ *
+ * @return Maximum length of the report or negative ThingSet response code in case of error
+ */
+int thingset_report_size_max(struct thingset_context *ts, const char *path,
+                             enum thingset_data_format format);
+
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+
+/**
+ * Export data objects belonging to subset(s) which were changed after the given data version.
+ *
+ * See thingset_export_subsets() for further details.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param buf Pointer to the buffer where the data should be stored
+ * @param buf_size Size of the buffer, i.e. maximum allowed length of the data
+ * @param subsets Flags to select which subset(s) of data items should be exported
+ * @param format Protocol data format to be used (text or binary with IDs)
+ * @param version Pointer to the data version of the previous export (0 to export all data
+ *                objects), updated to the current data version in case of success
+ *
+ * @returns Actual length of the data, 0 if no data object was changed or negative ThingSet
+ *          response code in case of error
+ */
+int thingset_export_subsets_changes(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                                    uint16_t subsets, enum thingset_data_format format,
+                                    uint32_t *version);
+
+/**
+ * Generate a report for a subset containing only the data objects which were changed after the
+ * given data version.
+ *
+ * The version is updated to the current data version after each report, so that the next
+ * report contains only the data objects changed in the meantime. In order to send a full
+ * report periodically (e.g. for receivers which missed previous reports), set the version to 0.
+ *
+ * See thingset_report_path() for further details.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param buf Pointer to the buffer where the report should be stored
+ * @param buf_size Size of the buffer, i.e. maximum allowed length of the report
+ * @param path Path of the subset to be published
+ * @param format Protocol data format to be used (text, binary with IDs or binary with names)
+ * @param version Pointer to the data version of the previous report (0 for a full report),
+ *                updated to the current data version in case of success
+ *
+ * @return Actual length of the report, 0 if no data object was changed or negative ThingSet
+ *         response code in case of error
+ */
+int thingset_report_path_changes(struct thingset_context *ts, char *buf, size_t buf_size,
+                                 const char *path, enum thingset_data_format format,
+                                 uint32_t *version);
+
+/**
+ * Set the value of a data object and mark it as changed if the value is different.
+ *
+ * Only supported for data objects with simple types (numbers, booleans and decimal fractions).
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param id ID of the data object
+ * @param value Pointer to the new value (same type as the data object)
+ *
+ * @returns 0 for success or negative ThingSet response code in case of error
+ */
+int thingset_set_value(struct thingset_context *ts, thingset_object_id_t id, const void *value);
+
+/**
+ * Mark a data object as changed after its value was modified directly by the application.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param id ID of the data object
+ *
+ * @returns 0 for success or negative ThingSet response code in case of error
+ */
+int thingset_mark_changed(struct thingset_context *ts, thingset_object_id_t id);
+
+/**
+ * Get the current data version of the context.
+ *
+ * @param ts Pointer to ThingSet context.
+ *
+ * @returns Data version, incremented with every change of a data object
+ */
+static inline uint32_t thingset_get_data_version(struct thingset_context *ts)
+{
+    return ts->data_version;
+}
+
+#endif /* CONFIG_THINGSET_CHANGE_TRACKING */
+
 /**
  * Set current authentication level.
  *
@@ -1944,6 +2794,10 @@ void thingset_set_update_callback(struct thingset_context *ts, const uint16_t su
  * @param path Relative path with multiple object names separated by forward slash.
  * @param len Length of the entire path.
  *
+ * @note If CONFIG_THINGSET_ENDPOINT_CACHE is enabled, this function updates the endpoint cache
+ * of the context. It must not be called in parallel to thingset_process_message for the same
+ * context in this case.
+ *
  * @return 0 if successful or negative ThingSet error code to be reported
  */
 int thingset_endpoint_by_path(struct thingset_context *ts, struct thingset_endpoint *endpoint,
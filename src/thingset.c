@@ -9,6 +9,7 @@
 #include "thingset_internal.h"
 
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/__assert.h>
 #include <zephyr/toolchain/common.h>
 
 #include <stdio.h>
@@ -27,7 +28,7 @@ extern struct thingset_data_object _thingset_data_object_list_end[];
 #define TYPE_SECTION_START(secname) _CONCAT(_##secname, _list_start)
 #endif /* STRUCT_SECTION_START_EXTERN */
 
-/* dummy objects to avoid using NULL pointer for root object or _Paths/_Metadata overlays */
+/* dummy objects to avoid using NULL pointer for root object or overlays like _Paths */
 static struct thingset_data_object root_object = THINGSET_GROUP(0, 0, "", NULL);
 static struct thingset_data_object paths_object =
     THINGSET_GROUP(0, THINGSET_ID_PATHS, "_Paths", NULL);
@@ -35,6 +36,10 @@ static struct thingset_data_object paths_object =
 static struct thingset_data_object metadata_object =
     THINGSET_GROUP(0, THINGSET_ID_METADATA, "_Metadata", NULL);
 #endif
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+static struct thingset_data_object changes_object =
+    THINGSET_GROUP(0, THINGSET_ID_CHANGES, "_Changes", NULL);
+#endif
 
 static char *type_name_lookup[THINGSET_TYPE_FN_I32 + 1] = {
     "bool",   "u8",    "i8",     "u16",     "i16",      "u32",    "i32",
@@ -42,201 +47,2144 @@ static char *type_name_lookup[THINGSET_TYPE_FN_I32 + 1] = {
     "record", "group", "subset", "()->()",  "()->(i32)"
 };
 
+/* number of IDs covered by the bitmap in each pass of the duplicate check */
+#define ID_BITMAP_SIZE 1024
+
+/*
+ * A small bitmap of already seen IDs is moved over the range of used IDs, so that no additional
+ * memory per object is needed. After the first pass starting at ID 0, each pass covers the
+ * ID_BITMAP_SIZE IDs from the lowest ID not checked yet, so ranges without any objects are
+ * skipped. As IDs are 16-bit, there are at most 64 passes over the objects.
+ */
 static void check_id_duplicates(const struct thingset_data_object *objects, size_t num)
 {
-    for (unsigned int i = 0; i < num; i++) {
-        for (unsigned int j = i + 1; j < num; j++) {
-            if (objects[i].id == objects[j].id) {
-                LOG_ERR("Duplicate data object ID 0x%X.\n", objects[i].id);
+    uint32_t seen[ID_BITMAP_SIZE / 32];
+    uint32_t start = 0;
+    uint32_t next_start;
+
+    do {
+        next_start = UINT32_MAX;
+        memset(seen, 0, sizeof(seen));
+        for (unsigned int i = 0; i < num; i++) {
+            /* IDs below the start wrap around and are skipped as well */
+            uint32_t offset = objects[i].id - start;
+            if (offset < ID_BITMAP_SIZE) {
+                uint32_t mask = 1U << (offset % 32);
+                if (seen[offset / 32] & mask) {
+                    LOG_ERR("Duplicate data object ID 0x%X.", objects[i].id);
+                }
+                seen[offset / 32] |= mask;
+            }
+            else if (objects[i].id > start) {
+                next_start = MIN(next_start, objects[i].id);
             }
         }
+        start = next_start;
+    } while (start != UINT32_MAX);
+}
+
+#ifdef CONFIG_THINGSET_INDEX_MAX_OBJECTS
+
+/*
+ * With lazy build, the indices are only used after they were completely built in the first
+ * locked entry point, so lookups without the lock fall back to a linear search until then.
+ */
+static inline bool index_available(struct thingset_context *ts)
+{
+#ifdef CONFIG_THINGSET_INDEX_LAZY_BUILD
+    if (!atomic_get(&ts->indices_built)) {
+        return false;
     }
+#endif
+
+    return ts->num_objects <= CONFIG_THINGSET_INDEX_MAX_OBJECTS;
 }
 
-static void thingset_init_common(struct thingset_context *ts)
+#endif /* CONFIG_THINGSET_INDEX_MAX_OBJECTS */
+
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+
+static void build_hot_arrays(struct thingset_context *ts)
+{
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        ts->hot_ids[i] = ts->data_objects[i].id;
+        ts->hot_parent_ids[i] = ts->data_objects[i].parent_id;
+        ts->hot_subsets[i] = ts->data_objects[i].subsets;
+    }
+}
+
+#endif /* CONFIG_THINGSET_OBJECT_HOT_ARRAYS */
+
+/*
+ * Accessors for the fields used in scans over the object database, reading from the dense arrays
+ * if available. The availability should be checked once before the loop.
+ */
+
+static inline bool hot_arrays_available(struct thingset_context *ts)
+{
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    return index_available(ts);
+#else
+    return false;
+#endif
+}
+
+static inline uint16_t object_id_at(struct thingset_context *ts, bool hot, unsigned int i)
 {
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    if (hot) {
+        return ts->hot_ids[i];
+    }
+#endif
+    return ts->data_objects[i].id;
+}
+
+static inline uint16_t object_parent_id_at(struct thingset_context *ts, bool hot, unsigned int i)
+{
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    if (hot) {
+        return ts->hot_parent_ids[i];
+    }
+#endif
+    return ts->data_objects[i].parent_id;
+}
+
+static inline uint8_t object_subsets_at(struct thingset_context *ts, bool hot, unsigned int i)
+{
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    if (hot) {
+        return ts->hot_subsets[i];
+    }
+#endif
+    return ts->data_objects[i].subsets;
+}
+
+#if defined(CONFIG_THINGSET_OBJECT_LOOKUP_MAP) || defined(CONFIG_THINGSET_NAME_INDEX) \
+    || defined(CONFIG_THINGSET_PATH_INDEX)
+
+#define HASH_TABLE_EMPTY UINT16_MAX
+
+/*
+ * Number of hash bits for a table with the given maximum number of slots, resulting in a load
+ * factor of max. 0.5 if the table is large enough (and always less than 1).
+ */
+static unsigned int hash_table_bits(size_t num_objects, size_t max_slots)
+{
+    unsigned int bits = 1;
+    while ((1U << bits) < 2 * num_objects) {
+        bits++;
+    }
+    if ((1U << bits) > max_slots) {
+        bits--;
+    }
+    return bits;
+}
+
+/* Fibonacci hashing spreads sequential and block-wise assigned keys evenly over the table */
+static inline unsigned int hash_table_slot(uint32_t hash, unsigned int bits)
+{
+    return (hash * 2654435761U) >> (32 - bits);
+}
+
+static void hash_table_insert(uint16_t *table, unsigned int bits, uint32_t hash, uint16_t index)
+{
+    unsigned int mask = (1U << bits) - 1;
+    unsigned int slot = hash_table_slot(hash, bits);
+
+    while (table[slot] != HASH_TABLE_EMPTY) {
+        slot = (slot + 1) & mask;
+    }
+    table[slot] = index;
+}
+
+#endif /* CONFIG_THINGSET_OBJECT_LOOKUP_MAP || CONFIG_THINGSET_NAME_INDEX || \
+          CONFIG_THINGSET_PATH_INDEX */
+
 #ifdef CONFIG_THINGSET_OBJECT_LOOKUP_MAP
-    for (unsigned int b = 0; b < CONFIG_THINGSET_OBJECT_LOOKUP_BUCKETS; b++) {
-        sys_slist_init(&ts->data_objects_lookup[b]);
+
+static void build_lookup_map(struct thingset_context *ts)
+{
+    unsigned int bits = hash_table_bits(ts->num_objects, ARRAY_SIZE(ts->data_objects_lookup));
+
+    ts->data_objects_lookup_bits = bits;
+    memset(ts->data_objects_lookup, 0xFF, (1U << bits) * sizeof(ts->data_objects_lookup[0]));
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        hash_table_insert(ts->data_objects_lookup, bits, ts->data_objects[i].id, i);
+    }
+}
+
+#endif /* CONFIG_THINGSET_OBJECT_LOOKUP_MAP */
+
+#if defined(CONFIG_THINGSET_NAME_INDEX) || defined(CONFIG_THINGSET_PATH_INDEX) \
+    || defined(CONFIG_THINGSET_ENDPOINT_CACHE)
+
+#define FNV1A_OFFSET_BASIS 2166136261U
+
+/* continue FNV-1a hash calculation for the given data */
+static uint32_t fnv1a_hash(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
     }
 
+    return hash;
+}
+
+#endif /* CONFIG_THINGSET_NAME_INDEX || CONFIG_THINGSET_PATH_INDEX || \
+          CONFIG_THINGSET_ENDPOINT_CACHE */
+
+#ifdef CONFIG_THINGSET_NAME_INDEX
+
+/* hash of parent ID and object name */
+static uint32_t name_hash(uint16_t parent_id, const char *name, size_t len)
+{
+    uint8_t parent_bytes[2] = { parent_id & 0xFF, parent_id >> 8 };
+
+    return fnv1a_hash(fnv1a_hash(FNV1A_OFFSET_BASIS, parent_bytes, 2), name, len);
+}
+
+static void build_name_index(struct thingset_context *ts)
+{
+    unsigned int bits = hash_table_bits(ts->num_objects, ARRAY_SIZE(ts->name_lookup));
+
+    ts->name_lookup_bits = bits;
+    memset(ts->name_lookup, 0xFF, (1U << bits) * sizeof(ts->name_lookup[0]));
+
     for (unsigned int i = 0; i < ts->num_objects; i++) {
-        struct thingset_data_object *object = &ts->data_objects[i];
-        sys_slist_append(
-            &ts->data_objects_lookup[object->id % CONFIG_THINGSET_OBJECT_LOOKUP_BUCKETS],
-            &object->node);
+        const struct thingset_data_object *object = &ts->data_objects[i];
+        size_t len = strlen(object->name);
+        uint32_t hash = name_hash(object->parent_id, object->name, len);
+        ts->name_hashes[i] = (uint16_t)hash;
+        ts->name_lengths[i] = MIN(len, UINT8_MAX);
+        hash_table_insert(ts->name_lookup, bits, hash, i);
     }
-#endif
-    ts->auth_flags = THINGSET_USR_MASK;
+}
 
-    k_sem_init(&ts->lock, 1, 1);
+static struct thingset_data_object *name_index_lookup(struct thingset_context *ts,
+                                                      uint16_t parent_id, const char *name,
+                                                      size_t len)
+{
+    uint32_t hash = name_hash(parent_id, name, len);
+    unsigned int mask = (1U << ts->name_lookup_bits) - 1;
+
+    for (unsigned int slot = hash_table_slot(hash, ts->name_lookup_bits);
+         ts->name_lookup[slot] != HASH_TABLE_EMPTY; slot = (slot + 1) & mask)
+    {
+        uint16_t i = ts->name_lookup[slot];
+        if (ts->name_hashes[i] == (uint16_t)hash && ts->name_lengths[i] == MIN(len, UINT8_MAX)) {
+            struct thingset_data_object *object = &ts->data_objects[i];
+            if (object->parent_id == parent_id && strncmp(object->name, name, len) == 0
+                && (len < UINT8_MAX || strlen(object->name) == len))
+            {
+                return object;
+            }
+        }
+    }
+
+    return NULL;
 }
 
-void thingset_init(struct thingset_context *ts, struct thingset_data_object *objects,
-                   size_t num_objects)
+#endif /* CONFIG_THINGSET_NAME_INDEX */
+
+#ifdef CONFIG_THINGSET_PATH_INDEX
+
+#define PATH_INDEX_NONE UINT16_MAX
+
+/* same limit as used for path parsing in thingset_get_object_by_path */
+#define PATH_INDEX_MAX_DEPTH 10
+
+/* hash of the full path, calculated by passing the segments from root to the object */
+static uint32_t path_index_hash(struct thingset_context *ts, unsigned int index)
 {
-    check_id_duplicates(objects, num_objects);
+    uint16_t segments[PATH_INDEX_MAX_DEPTH];
+    int depth = 0;
+
+    do {
+        segments[depth++] = index;
+        index = ts->path_parents[index];
+    } while (index != PATH_INDEX_NONE);
+
+    uint32_t hash = FNV1A_OFFSET_BASIS;
+    while (depth > 0) {
+        const char *name = ts->data_objects[segments[--depth]].name;
+        hash = fnv1a_hash(hash, name, strlen(name));
+        if (depth > 0) {
+            hash = fnv1a_hash(hash, "/", 1);
+        }
+    }
 
-    ts->data_objects = objects;
-    ts->num_objects = num_objects;
-    thingset_init_common(ts);
+    return hash;
 }
 
-void thingset_init_global(struct thingset_context *ts)
+static struct thingset_data_object *find_object_by_id(struct thingset_context *ts, uint16_t id,
+                                                      bool indexed);
+
+static void build_path_index(struct thingset_context *ts)
 {
-    /* duplicates are checked at compile-time */
+    unsigned int bits = hash_table_bits(ts->num_objects, ARRAY_SIZE(ts->path_lookup));
 
-    ts->data_objects = TYPE_SECTION_START(thingset_data_object);
-    STRUCT_SECTION_COUNT(thingset_data_object, &ts->num_objects);
-    thingset_init_common(ts);
+    ts->path_lookup_bits = bits;
+    memset(ts->path_lookup, 0xFF, (1U << bits) * sizeof(ts->path_lookup[0]));
+
+    /* objects with missing parent are marked with invalid length */
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        ts->path_parents[i] = PATH_INDEX_NONE;
+        ts->path_lengths[i] = 0;
+        if (ts->data_objects[i].parent_id != 0) {
+            /* the index by ID is already built, but not yet indicated as available */
+            struct thingset_data_object *parent =
+                find_object_by_id(ts, ts->data_objects[i].parent_id, true);
+            if (parent != NULL) {
+                ts->path_parents[i] = parent - ts->data_objects;
+            }
+            else {
+                ts->path_lengths[i] = PATH_INDEX_NONE;
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        size_t len = strlen(ts->data_objects[i].name);
+        unsigned int ancestor = i;
+        int depth = 1;
+        while (ts->path_lengths[ancestor] != PATH_INDEX_NONE
+               && ts->path_parents[ancestor] != PATH_INDEX_NONE && depth < PATH_INDEX_MAX_DEPTH)
+        {
+            ancestor = ts->path_parents[ancestor];
+            len += strlen(ts->data_objects[ancestor].name) + 1;
+            depth++;
+        }
+
+        if (ts->path_lengths[ancestor] == PATH_INDEX_NONE
+            || ts->path_parents[ancestor] != PATH_INDEX_NONE || len >= PATH_INDEX_NONE)
+        {
+            /* object not reachable from root or path too long */
+            ts->path_lengths[i] = PATH_INDEX_NONE;
+        }
+        else {
+            ts->path_lengths[i] = len;
+        }
+    }
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        if (ts->path_lengths[i] != PATH_INDEX_NONE) {
+            uint32_t hash = path_index_hash(ts, i);
+            ts->path_hashes[i] = (uint16_t)hash;
+            hash_table_insert(ts->path_lookup, bits, hash, i);
+        }
+    }
 }
 
-int thingset_process_message(struct thingset_context *ts, const uint8_t *msg, size_t msg_len,
-                             uint8_t *rsp, size_t rsp_size)
+/* compare the path of an object with the given path, starting from the end */
+static bool path_index_matches(struct thingset_context *ts, unsigned int index, const char *path)
 {
-    int ret;
+    size_t pos = ts->path_lengths[index];
+
+    while (true) {
+        const char *name = ts->data_objects[index].name;
+        size_t len = strlen(name);
+        pos -= len;
+        if (memcmp(path + pos, name, len) != 0) {
+            return false;
+        }
 
-    if (msg == NULL || msg_len < 1) {
-        return -THINGSET_ERR_BAD_REQUEST;
+        index = ts->path_parents[index];
+        if (index == PATH_INDEX_NONE) {
+            return true;
+        }
+
+        if (path[--pos] != '/') {
+            return false;
+        }
     }
+}
 
-    if (rsp == NULL || rsp_size < 4) {
-        /* response buffer with at least 4 bytes required to fit minimum response */
-        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+static struct thingset_data_object *path_index_lookup(struct thingset_context *ts,
+                                                      const char *path, size_t len)
+{
+    uint32_t hash = fnv1a_hash(FNV1A_OFFSET_BASIS, path, len);
+    unsigned int mask = (1U << ts->path_lookup_bits) - 1;
+
+    for (unsigned int slot = hash_table_slot(hash, ts->path_lookup_bits);
+         ts->path_lookup[slot] != HASH_TABLE_EMPTY; slot = (slot + 1) & mask)
+    {
+        uint16_t i = ts->path_lookup[slot];
+        if (ts->path_hashes[i] == (uint16_t)hash && ts->path_lengths[i] == len
+            && path_index_matches(ts, i, path))
+        {
+            return &ts->data_objects[i];
+        }
     }
 
-    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
-        LOG_ERR("ThingSet context lock timed out");
-        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    return NULL;
+}
+
+/* assemble the path from the end to the beginning, so that no recursion is required */
+static int path_index_write(struct thingset_context *ts, unsigned int index, char *buf,
+                            size_t size)
+{
+    size_t path_len = ts->path_lengths[index];
+    size_t pos = path_len;
+
+    if (path_len >= size) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
     }
 
-    ts->msg = msg;
-    ts->msg_len = msg_len;
-    ts->msg_pos = 0;
+    buf[pos] = '\0';
 
-    ts->rsp = rsp;
-    ts->rsp_size = rsp_size;
-    ts->rsp_pos = 0;
+    while (true) {
+        const char *name = ts->data_objects[index].name;
+        size_t len = strlen(name);
+        pos -= len;
+        memcpy(buf + pos, name, len);
 
-    if (IS_ENABLED(CONFIG_THINGSET_TEXT_MODE) && ts->msg[0] >= 0x20) {
-        ret = thingset_txt_process(ts);
+        index = ts->path_parents[index];
+        if (index == PATH_INDEX_NONE) {
+            break;
+        }
+
+        buf[--pos] = '/';
     }
-    else {
-        ret = thingset_bin_process(ts);
+
+    return path_len;
+}
+
+#endif /* CONFIG_THINGSET_PATH_INDEX */
+
+#if defined(CONFIG_THINGSET_ID_INDEX) || defined(CONFIG_THINGSET_CHILD_INDEX)
+
+typedef uint16_t (*object_key_fn)(const struct thingset_data_object *object);
+
+/* compare object indices by key and use the index itself as tie-breaker to keep the order stable */
+static inline bool index_less(const struct thingset_data_object *objects, object_key_fn key,
+                              uint16_t a, uint16_t b)
+{
+    uint16_t key_a = key(&objects[a]);
+    uint16_t key_b = key(&objects[b]);
+
+    return key_a < key_b || (key_a == key_b && a < b);
+}
+
+static void sift_down(const struct thingset_data_object *objects, object_key_fn key,
+                      uint16_t *indices, size_t root, size_t end)
+{
+    while (2 * root + 1 < end) {
+        size_t child = 2 * root + 1;
+        if (child + 1 < end && index_less(objects, key, indices[child], indices[child + 1])) {
+            child++;
+        }
+        if (!index_less(objects, key, indices[root], indices[child])) {
+            return;
+        }
+        uint16_t tmp = indices[root];
+        indices[root] = indices[child];
+        indices[child] = tmp;
+        root = child;
     }
+}
 
-    k_sem_give(&ts->lock);
+/* in-place heap sort of object indices, so no additional buffer is required */
+static void sort_object_indices(const struct thingset_data_object *objects, object_key_fn key,
+                                uint16_t *indices, size_t num)
+{
+    for (unsigned int i = 0; i < num; i++) {
+        indices[i] = i;
+    }
 
-    return ret;
+    for (size_t start = num / 2; start > 0; start--) {
+        sift_down(objects, key, indices, start - 1, num);
+    }
+
+    for (size_t end = num; end > 1; end--) {
+        uint16_t tmp = indices[0];
+        indices[0] = indices[end - 1];
+        indices[end - 1] = tmp;
+        sift_down(objects, key, indices, 0, end - 1);
+    }
 }
 
-int thingset_export_subsets_progressively(struct thingset_context *ts, uint8_t *buf,
-                                          size_t buf_size, uint16_t subsets,
-                                          enum thingset_data_format format, unsigned int *index,
-                                          size_t *len)
+#endif /* CONFIG_THINGSET_ID_INDEX || CONFIG_THINGSET_CHILD_INDEX */
+
+#ifdef CONFIG_THINGSET_ID_INDEX
+
+static uint16_t object_id(const struct thingset_data_object *object)
 {
-    if (*index == 0) {
-        if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
-            LOG_ERR("ThingSet context lock timed out");
-            return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    return object->id;
+}
+
+static void build_id_index(struct thingset_context *ts)
+{
+    sort_object_indices(ts->data_objects, object_id, ts->id_index, ts->num_objects);
+}
+
+#endif /* CONFIG_THINGSET_ID_INDEX */
+
+#ifdef CONFIG_THINGSET_CHILD_INDEX
+
+static uint16_t object_parent_id(const struct thingset_data_object *object)
+{
+    return object->parent_id;
+}
+
+/* position of the first object with the given parent ID in the child index */
+static unsigned int child_index_lower_bound(struct thingset_context *ts, uint16_t parent_id)
+{
+    unsigned int low = 0;
+    unsigned int high = ts->num_objects;
+
+    while (low < high) {
+        unsigned int mid = low + (high - low) / 2;
+        if (ts->data_objects[ts->child_index[mid]].parent_id < parent_id) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
         }
+    }
 
-        ts->rsp = buf;
-        ts->rsp_size = buf_size;
-        ts->rsp_pos = 0;
+    return low;
+}
 
-        switch (format) {
-            case THINGSET_BIN_IDS_VALUES:
-                ts->endpoint.use_ids = true;
-                thingset_bin_setup(ts, 0);
-                break;
-            default:
-                k_sem_give(&ts->lock);
-                return -THINGSET_ERR_NOT_IMPLEMENTED;
+static void build_child_index(struct thingset_context *ts)
+{
+    sort_object_indices(ts->data_objects, object_parent_id, ts->child_index, ts->num_objects);
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        ts->child_offsets[i] = child_index_lower_bound(ts, ts->data_objects[i].id);
+    }
+}
+
+#endif /* CONFIG_THINGSET_CHILD_INDEX */
+
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+
+static void build_subset_index(struct thingset_context *ts)
+{
+    size_t total = 0;
+
+    ts->subset_index_valid = false;
+
+    for (unsigned int bit = 0; bit < THINGSET_NUM_SUBSETS; bit++) {
+        ts->subset_offsets[bit] = total;
+        for (unsigned int i = 0; i < ts->num_objects; i++) {
+            if (ts->data_objects[i].subsets & (1U << bit)) {
+                if (total >= ARRAY_SIZE(ts->subset_members)) {
+                    LOG_WRN("Subset index too small, using linear search");
+                    return;
+                }
+                ts->subset_members[total++] = i;
+            }
         }
     }
-    int ret = thingset_bin_export_subsets_progressively(ts, subsets, index, len);
-    if (ret <= 0) {
-        k_sem_give(&ts->lock);
+    ts->subset_offsets[THINGSET_NUM_SUBSETS] = total;
+
+    ts->subset_index_valid = true;
+}
+
+/* position of the first member of the subset with an index >= the given index */
+static unsigned int subset_lower_bound(struct thingset_context *ts, unsigned int bit,
+                                       unsigned int index)
+{
+    unsigned int low = ts->subset_offsets[bit];
+    unsigned int high = ts->subset_offsets[bit + 1];
+
+    while (low < high) {
+        unsigned int mid = low + (high - low) / 2;
+        if (ts->subset_members[mid] < index) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+#ifndef CONFIG_THINGSET_IMMUTABLE_OBJECTS
+
+static void subset_index_insert(struct thingset_context *ts, unsigned int bit, uint16_t index)
+{
+    unsigned int pos = subset_lower_bound(ts, bit, index);
+    unsigned int end = ts->subset_offsets[THINGSET_NUM_SUBSETS];
+
+    memmove(&ts->subset_members[pos + 1], &ts->subset_members[pos],
+            (end - pos) * sizeof(ts->subset_members[0]));
+    ts->subset_members[pos] = index;
+
+    for (unsigned int i = bit + 1; i <= THINGSET_NUM_SUBSETS; i++) {
+        ts->subset_offsets[i]++;
+    }
+}
+
+static void subset_index_remove(struct thingset_context *ts, unsigned int bit, uint16_t index)
+{
+    unsigned int pos = subset_lower_bound(ts, bit, index);
+    unsigned int end = ts->subset_offsets[THINGSET_NUM_SUBSETS];
+
+    memmove(&ts->subset_members[pos], &ts->subset_members[pos + 1],
+            (end - pos - 1) * sizeof(ts->subset_members[0]));
+
+    for (unsigned int i = bit + 1; i <= THINGSET_NUM_SUBSETS; i++) {
+        ts->subset_offsets[i]--;
+    }
+}
+
+#endif /* CONFIG_THINGSET_IMMUTABLE_OBJECTS */
+
+#endif /* CONFIG_THINGSET_SUBSET_INDEX */
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+
+static void init_change_tracking(struct thingset_context *ts)
+{
+    ts->data_version = 1;
+    ts->changes_since = 0;
+
+    for (unsigned int i = 0; i < ts->num_objects && i < ARRAY_SIZE(ts->object_versions); i++) {
+        ts->object_versions[i] = ts->data_version;
+    }
+
+    if (ts->num_objects > ARRAY_SIZE(ts->object_versions)) {
+        LOG_WRN("Changes of %zu data objects not tracked, increase THINGSET_INDEX_MAX_OBJECTS",
+                ts->num_objects - ARRAY_SIZE(ts->object_versions));
+    }
+}
+
+/* data objects without stored version are always considered as changed */
+static inline uint32_t object_version_at(struct thingset_context *ts, unsigned int index)
+{
+    return index < ARRAY_SIZE(ts->object_versions) ? ts->object_versions[index] : UINT32_MAX;
+}
+
+#endif /* CONFIG_THINGSET_CHANGE_TRACKING */
+
+/* indicates if unchanged data objects are currently skipped during subset iteration */
+static inline bool subset_changes_only(struct thingset_context *ts)
+{
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    return ts->changes_since != 0;
+#else
+    return false;
+#endif
+}
+
+#ifdef CONFIG_THINGSET_RECORD_FIELD_CACHE
+
+#define RECORD_FIELDS_END UINT16_MAX
+
+static void build_record_field_cache(struct thingset_context *ts)
+{
+    size_t len = 0;
+
+    ts->record_fields_valid = false;
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        const struct thingset_data_object *records = &ts->data_objects[i];
+        if (records->type != THINGSET_TYPE_RECORDS) {
+            continue;
+        }
+
+        if (len >= ARRAY_SIZE(ts->record_fields)) {
+            goto overflow;
+        }
+        ts->record_fields[len++] = records->id;
+
+        unsigned int pos;
+        for (struct thingset_data_object *field = thingset_get_first_child(ts, records, &pos);
+             field != NULL; field = thingset_get_next_child(ts, records, &pos))
+        {
+            if (len >= ARRAY_SIZE(ts->record_fields)) {
+                goto overflow;
+            }
+            ts->record_fields[len++] = field - ts->data_objects;
+        }
+
+        if (len >= ARRAY_SIZE(ts->record_fields)) {
+            goto overflow;
+        }
+        ts->record_fields[len++] = RECORD_FIELDS_END;
+    }
+
+    /* terminate list of records objects with an empty entry */
+    if (len < ARRAY_SIZE(ts->record_fields)) {
+        ts->record_fields[len] = RECORD_FIELDS_END;
+    }
+
+    ts->record_fields_valid = true;
+    return;
+
+overflow:
+    LOG_WRN("Record field cache too small, using child lookup");
+}
+
+/* position of the first field of the records object with the given ID in the cache */
+static unsigned int record_fields_find(struct thingset_context *ts, uint16_t records_id)
+{
+    unsigned int pos = 0;
+
+    while (pos < ARRAY_SIZE(ts->record_fields) && ts->record_fields[pos] != RECORD_FIELDS_END) {
+        if (ts->record_fields[pos++] == records_id) {
+            return pos;
+        }
+        /* skip fields of other records object */
+        while (ts->record_fields[pos++] != RECORD_FIELDS_END) {
+        }
+    }
+
+    /* not cached (e.g. no records object), so pointing to an end marker or beyond the cache */
+    return pos;
+}
+
+#endif /* CONFIG_THINGSET_RECORD_FIELD_CACHE */
+
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+
+static void endpoint_cache_reset(struct thingset_context *ts)
+{
+    for (unsigned int i = 0; i < CONFIG_THINGSET_ENDPOINT_CACHE_SIZE; i++) {
+        ts->endpoint_cache[i].path_len = 0;
+        ts->endpoint_cache_order[i] = i;
+    }
+    ts->endpoint_cache_hits = 0;
+    ts->endpoint_cache_misses = 0;
+}
+
+/* mark the entry at the given position in the LRU order as most recently used */
+static void endpoint_cache_touch(struct thingset_context *ts, unsigned int pos)
+{
+    uint8_t entry = ts->endpoint_cache_order[pos];
+
+    memmove(&ts->endpoint_cache_order[1], &ts->endpoint_cache_order[0], pos);
+    ts->endpoint_cache_order[0] = entry;
+}
+
+static bool endpoint_cache_get(struct thingset_context *ts, struct thingset_endpoint *endpoint,
+                               const char *path, size_t path_len, uint32_t hash)
+{
+    for (unsigned int pos = 0; pos < CONFIG_THINGSET_ENDPOINT_CACHE_SIZE; pos++) {
+        struct thingset_endpoint_cache_entry *entry =
+            &ts->endpoint_cache[ts->endpoint_cache_order[pos]];
+        if (entry->path_len == 0) {
+            /* all following entries are unused, too */
+            break;
+        }
+        if (entry->hash == hash && entry->path_len == path_len
+            && memcmp(entry->path, path, path_len) == 0)
+        {
+            endpoint->object = entry->endpoint.object;
+            endpoint->index = entry->endpoint.index;
+            endpoint_cache_touch(ts, pos);
+            ts->endpoint_cache_hits++;
+            return true;
+        }
+    }
+
+    ts->endpoint_cache_misses++;
+    return false;
+}
+
+static void endpoint_cache_put(struct thingset_context *ts,
+                               const struct thingset_endpoint *endpoint, const char *path,
+                               size_t path_len, uint32_t hash)
+{
+    /* replace least recently used entry */
+    unsigned int pos = CONFIG_THINGSET_ENDPOINT_CACHE_SIZE - 1;
+    struct thingset_endpoint_cache_entry *entry =
+        &ts->endpoint_cache[ts->endpoint_cache_order[pos]];
+
+    entry->endpoint = *endpoint;
+    entry->hash = hash;
+    entry->path_len = path_len;
+    memcpy(entry->path, path, path_len);
+
+    endpoint_cache_touch(ts, pos);
+}
+
+#endif /* CONFIG_THINGSET_ENDPOINT_CACHE */
+
+#ifdef CONFIG_THINGSET_INDEX_MAX_OBJECTS
+
+static void build_indices(struct thingset_context *ts)
+{
+    if (ts->num_objects > CONFIG_THINGSET_INDEX_MAX_OBJECTS) {
+        LOG_ERR("Indices too small for %zu data objects, increase THINGSET_INDEX_MAX_OBJECTS",
+                ts->num_objects);
+        __ASSERT(false, "THINGSET_INDEX_MAX_OBJECTS too small");
+        return;
+    }
+
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    /* used by scans while building the other indices */
+    build_hot_arrays(ts);
+#endif
+#ifdef CONFIG_THINGSET_OBJECT_LOOKUP_MAP
+    build_lookup_map(ts);
+#endif
+#ifdef CONFIG_THINGSET_NAME_INDEX
+    build_name_index(ts);
+#endif
+#ifdef CONFIG_THINGSET_ID_INDEX
+    build_id_index(ts);
+#endif
+#ifdef CONFIG_THINGSET_CHILD_INDEX
+    build_child_index(ts);
+#endif
+#ifdef CONFIG_THINGSET_PATH_INDEX
+    /* requires lookup by ID, so it has to be built after the other indices */
+    build_path_index(ts);
+#endif
+}
+
+#endif /* CONFIG_THINGSET_INDEX_MAX_OBJECTS */
+
+/* must be called with the context lock held, so that the indices are only built once */
+static inline void build_indices_lazy(struct thingset_context *ts)
+{
+#ifdef CONFIG_THINGSET_INDEX_LAZY_BUILD
+    if (!atomic_get(&ts->indices_built)) {
+        build_indices(ts);
+        /* indicate availability only after all indices are complete */
+        atomic_set(&ts->indices_built, true);
+    }
+#endif
+}
+
+#if defined(CONFIG_THINGSET_BINARY_KEY_CACHE) || defined(CONFIG_THINGSET_TEXT_KEY_CACHE)
+
+static void build_key_cache(struct thingset_context *ts)
+{
+    ts->key_cache_valid = false;
+
+    if (ts->num_objects > CONFIG_THINGSET_INDEX_MAX_OBJECTS) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < ts->num_objects; i++) {
+        size_t name_len = strlen(ts->data_objects[i].name);
+        ts->key_name_lengths[i] = name_len < UINT8_MAX ? name_len : UINT8_MAX;
+
+#ifdef CONFIG_THINGSET_BINARY_KEY_CACHE
+        uint16_t id = ts->data_objects[i].id;
+        uint8_t *key = ts->bin_key_ids[i];
+
+        /* smallest possible encoding of unsigned integer (major type 0) as required for canonical
+         * CBOR */
+        if (id < 24) {
+            key[0] = id;
+        }
+        else if (id <= UINT8_MAX) {
+            key[0] = 0x18;
+            key[1] = id;
+        }
+        else {
+            key[0] = 0x19;
+            key[1] = id >> 8;
+            key[2] = id & 0xFF;
+        }
+#endif
+    }
+
+    ts->key_cache_valid = true;
+}
+
+#endif /* CONFIG_THINGSET_BINARY_KEY_CACHE || CONFIG_THINGSET_TEXT_KEY_CACHE */
+
+static void thingset_init_common(struct thingset_context *ts)
+{
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+    /* cached endpoints point to the previous objects database */
+    endpoint_cache_reset(ts);
+#endif
+
+#if defined(CONFIG_THINGSET_INDEX_LAZY_BUILD)
+    atomic_set(&ts->indices_built, false);
+#elif defined(CONFIG_THINGSET_INDEX_MAX_OBJECTS)
+    build_indices(ts);
+#endif
+
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+    build_subset_index(ts);
+#endif
+
+#ifdef CONFIG_THINGSET_RECORD_FIELD_CACHE
+    build_record_field_cache(ts);
+#endif
+
+#if defined(CONFIG_THINGSET_BINARY_KEY_CACHE) || defined(CONFIG_THINGSET_TEXT_KEY_CACHE)
+    build_key_cache(ts);
+#endif
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    init_change_tracking(ts);
+#endif
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    /* templates prepared for the previous objects database are outdated */
+    ts->subsets_generation++;
+#endif
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    ts->sink = NULL;
+#endif
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+    ts->source = NULL;
+#endif
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    ts->iov = NULL;
+#endif
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    ts->cont_type = THINGSET_CONT_NONE;
+#endif
+
+    ts->auth_flags = THINGSET_USR_MASK;
+
+    k_sem_init(&ts->lock, 1, 1);
+}
+
+void thingset_init(struct thingset_context *ts, struct thingset_data_object *objects,
+                   size_t num_objects)
+{
+    /*
+     * Unlike the unique symbol names of the iterable section used by thingset_init_global, the
+     * IDs in an array are only values of an initializer list. C provides no constant expression
+     * to compare the elements of an array, so duplicates can only be detected at runtime.
+     */
+    check_id_duplicates(objects, num_objects);
+
+    ts->data_objects = objects;
+    ts->num_objects = num_objects;
+    thingset_init_common(ts);
+}
+
+void thingset_init_global(struct thingset_context *ts)
+{
+    /* duplicates are checked at compile-time */
+
+    ts->data_objects = TYPE_SECTION_START(thingset_data_object);
+    STRUCT_SECTION_COUNT(thingset_data_object, &ts->num_objects);
+    thingset_init_common(ts);
+}
+
+int thingset_process_message(struct thingset_context *ts, const uint8_t *msg, size_t msg_len,
+                             uint8_t *rsp, size_t rsp_size)
+{
+    int ret;
+
+    if (msg == NULL || msg_len < 1) {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    if (rsp == NULL || rsp_size < 4) {
+        /* response buffer with at least 4 bytes required to fit minimum response */
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->msg = msg;
+    ts->msg_len = msg_len;
+    ts->msg_pos = 0;
+
+    ts->rsp = rsp;
+    ts->rsp_size = rsp_size;
+    ts->rsp_pos = 0;
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    /* discard the remaining pieces of a previous response */
+    ts->cont_type = THINGSET_CONT_NONE;
+    ts->cont_msg = msg;
+    ts->cont_msg_len = msg_len;
+#endif
+
+    if (IS_ENABLED(CONFIG_THINGSET_TEXT_MODE) && ts->msg[0] >= 0x20) {
+        ret = thingset_txt_process(ts);
+    }
+    else {
+        ret = thingset_bin_process(ts);
+    }
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+int thingset_process_continue(struct thingset_context *ts, uint8_t *rsp, size_t rsp_size)
+{
+    int ret;
+
+    if (rsp == NULL || rsp_size < 4) {
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    if (ts->cont_type == THINGSET_CONT_NONE) {
+        k_sem_give(&ts->lock);
+        return 0;
+    }
+
+    ts->msg = ts->cont_msg;
+    ts->msg_len = ts->cont_msg_len;
+    ts->msg_pos = 0;
+
+    ts->rsp = rsp;
+    ts->rsp_size = rsp_size;
+    ts->rsp_pos = 0;
+
+    if (IS_ENABLED(CONFIG_THINGSET_TEXT_MODE) && ts->msg[0] >= 0x20) {
+        ret = thingset_txt_process_continue(ts);
+    }
+    else {
+        ret = thingset_bin_process_continue(ts);
+    }
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+bool thingset_response_continued(struct thingset_context *ts)
+{
+    return ts->cont_type != THINGSET_CONT_NONE;
+}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
+int thingset_export_subsets_progressively(struct thingset_context *ts, uint8_t *buf,
+                                          size_t buf_size, uint16_t subsets,
+                                          enum thingset_data_format format, unsigned int *index,
+                                          size_t *len)
+{
+    if (*index == 0) {
+        if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+            LOG_ERR("ThingSet context lock timed out");
+            return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+        }
+
+        build_indices_lazy(ts);
+
+        ts->rsp = buf;
+        ts->rsp_size = buf_size;
+        ts->rsp_pos = 0;
+
+        switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+            case THINGSET_TXT_NAMES_VALUES:
+                thingset_txt_setup(ts);
+                break;
+#endif
+            case THINGSET_BIN_IDS_VALUES:
+                ts->endpoint.use_ids = true;
+                thingset_bin_setup(ts, 0);
+                break;
+            default:
+                k_sem_give(&ts->lock);
+                return -THINGSET_ERR_NOT_IMPLEMENTED;
+        }
+    }
+
+    int ret;
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            ret = thingset_txt_export_subsets_progressively(ts, subsets, index, len);
+            break;
+#endif
+        default:
+            ret = thingset_bin_export_subsets_progressively(ts, subsets, index, len);
+            break;
+    }
+    if (ret <= 0) {
+        k_sem_give(&ts->lock);
+    }
+
+    return ret;
+}
+
+static int export_setup(struct thingset_context *ts, enum thingset_data_format format)
+{
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            thingset_txt_setup(ts);
+            break;
+#endif
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            break;
+        default:
+            return -THINGSET_ERR_NOT_IMPLEMENTED;
+    }
+
+    return 0;
+}
+
+static int export_subsets(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                          uint16_t subsets, enum thingset_data_format format)
+{
+    int ret;
+
+    ts->rsp = buf;
+    ts->rsp_size = buf_size;
+    ts->rsp_pos = 0;
+
+    ret = export_setup(ts, format);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ret = ts->api->serialize_subsets(ts, subsets);
+
+    ts->api->serialize_finish(ts);
+
+    if (ret == 0) {
+        ret = ts->rsp_pos;
+    }
+
+    return ret;
+}
+
+int thingset_export_subsets(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                            uint16_t subsets, enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ret = export_subsets(ts, buf, buf_size, subsets, format);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+int thingset_export_item(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                         const struct thingset_data_object *obj, enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->rsp = buf;
+    ts->rsp_size = buf_size;
+    ts->rsp_pos = 0;
+
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_VALUES_ONLY:
+            thingset_txt_setup(ts);
+            break;
+#endif
+        case THINGSET_BIN_VALUES_ONLY:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            break;
+        default:
+            ret = -THINGSET_ERR_NOT_IMPLEMENTED;
+            goto out;
+    }
+
+    ret = ts->api->serialize_value(ts, obj);
+
+    ts->api->serialize_finish(ts);
+
+    if (ret == 0) {
+        ret = ts->rsp_pos;
+    }
+
+out:
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+struct thingset_data_object *thingset_iterate_subsets(struct thingset_context *ts, uint16_t subset,
+                                                      struct thingset_data_object *start_obj)
+{
+    unsigned int index = 0;
+    if (start_obj != NULL) {
+        index = start_obj - ts->data_objects;
+    }
+
+    index = thingset_next_subset_member(ts, subset, index);
+    if (index < ts->num_objects) {
+        return &ts->data_objects[index];
+    }
+
+    return NULL;
+}
+
+int thingset_import_data_progressively(struct thingset_context *ts, const uint8_t *data, size_t len,
+                                       enum thingset_data_format format, uint8_t auth_flags,
+                                       uint32_t *last_id, size_t *consumed)
+{
+    int err = 0;
+
+    if (*last_id == 0) {
+        if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+            LOG_ERR("ThingSet context lock timed out");
+            return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+        }
+
+        build_indices_lazy(ts);
+
+        ts->msg = data;
+        ts->msg_len = len;
+        ts->msg_pos = 0;
+        ts->rsp = NULL;
+        ts->rsp_size = 0;
+        ts->rsp_pos = 0;
+
+        switch (format) {
+            case THINGSET_BIN_IDS_VALUES:
+                ts->endpoint.use_ids = true;
+                thingset_bin_setup(ts, 0);
+                ts->msg_payload = data;
+                ts->api->deserialize_payload_reset(ts);
+                break;
+            default:
+                err = -THINGSET_ERR_NOT_IMPLEMENTED;
+                k_sem_give(&ts->lock);
+                break;
+        }
+
+        if (err) {
+            return err;
+        }
+    }
+
+    err = thingset_bin_import_data_progressively(ts, auth_flags, len, last_id, consumed);
+    if (err < 0) {
+        k_sem_give(&ts->lock);
+    }
+    return err;
+}
+
+int thingset_import_data_progressively_end(struct thingset_context *ts)
+{
+    k_sem_give(&ts->lock);
+    return 0;
+}
+
+int thingset_import_data(struct thingset_context *ts, const uint8_t *data, size_t len,
+                         uint8_t auth_flags, enum thingset_data_format format)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->msg = data;
+    ts->msg_len = len;
+    ts->msg_pos = 0;
+    ts->rsp = NULL;
+    ts->rsp_size = 0;
+    ts->rsp_pos = 0;
+
+    switch (format) {
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            ts->msg_payload = data;
+            ts->api->deserialize_payload_reset(ts);
+            err = thingset_bin_import_data(ts, auth_flags, format);
+            break;
+        default:
+            err = -THINGSET_ERR_NOT_IMPLEMENTED;
+            break;
+    }
+
+    k_sem_give(&ts->lock);
+
+    return err;
+}
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+int thingset_source_refill(struct thingset_context *ts, size_t consumed)
+{
+    const struct thingset_source *source = ts->source;
+
+    if (ts->source_eof) {
+        /* data ended within an item */
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+    else if (consumed == 0 && ts->source_len == source->size) {
+        /* the window buffer is too small for a single item */
+        return -THINGSET_ERR_REQUEST_TOO_LARGE;
+    }
+
+    memmove(source->buf, source->buf + consumed, ts->source_len - consumed);
+    ts->source_len -= consumed;
+
+    while (!ts->source_eof && ts->source_len < source->size) {
+        int ret = source->read(source->buf + ts->source_len, source->size - ts->source_len,
+                               source->user_data);
+        if (ret < 0) {
+            return ret;
+        }
+        else if (ret == 0) {
+            ts->source_eof = true;
+        }
+        ts->source_len += ret;
+    }
+
+    return 0;
+}
+
+const struct thingset_data_object *thingset_source_lookup(struct thingset_context *ts,
+                                                          const struct thingset_data_object *parent,
+                                                          const char *name, size_t len)
+{
+    if (len == 0) {
+        /* an empty key must not resolve to the root object */
+        return NULL;
+    }
+
+    if (parent != NULL) {
+        return thingset_get_child_by_name(ts, parent->id, name, len);
+    }
+
+    int index;
+    const struct thingset_data_object *object = thingset_get_object_by_path(ts, name, len, &index);
+
+    /* single records are not supported */
+    return index == THINGSET_ENDPOINT_INDEX_NONE ? object : NULL;
+}
+
+void thingset_source_import_value(struct thingset_context *ts,
+                                  const struct thingset_data_object *object, uint8_t auth_flags)
+{
+    if ((object->access & THINGSET_WRITE_MASK & auth_flags) == 0) {
+        return;
+    }
+
+    if (ts->api->deserialize_value(ts, object, false) == 0) {
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+        thingset_object_changed(ts, object);
+#endif
+    }
+}
+
+int thingset_import_data_from_source(struct thingset_context *ts,
+                                     const struct thingset_source *source, uint8_t auth_flags,
+                                     enum thingset_data_format format)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->rsp = NULL;
+    ts->rsp_size = 0;
+    ts->rsp_pos = 0;
+
+    ts->source = source;
+    ts->source_len = 0;
+    ts->source_eof = false;
+
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            thingset_txt_setup(ts);
+            err = thingset_txt_import_source(ts, auth_flags);
+            break;
+#endif
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            err = thingset_bin_import_source(ts, auth_flags);
+            break;
+        case THINGSET_BIN_NAMES_VALUES:
+            ts->endpoint.use_ids = false;
+            thingset_bin_setup(ts, 0);
+            err = thingset_bin_import_source(ts, auth_flags);
+            break;
+        default:
+            err = -THINGSET_ERR_NOT_IMPLEMENTED;
+            break;
+    }
+
+    ts->source = NULL;
+
+    k_sem_give(&ts->lock);
+
+    return err;
+}
+
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
+int thingset_import_report(struct thingset_context *ts, const uint8_t *data, size_t len,
+                           uint8_t auth_flags, enum thingset_data_format format, uint16_t subset)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->msg = data;
+    ts->msg_len = len;
+    ts->msg_pos = 0;
+    ts->rsp = NULL;
+    ts->rsp_size = 0;
+    ts->rsp_pos = 0;
+
+    switch (format) {
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            ts->decoder->elem_count = 2;
+            ts->msg_payload = data;
+            err = thingset_bin_import_report(ts, auth_flags, subset);
+            break;
+        default:
+            err = -THINGSET_ERR_NOT_IMPLEMENTED;
+            break;
+    }
+
+    k_sem_give(&ts->lock);
+
+    return err;
+}
+
+static int deserialize_value_callback(struct thingset_context *ts,
+                                      const struct thingset_data_object *item_offset)
+{
+    return ts->api->deserialize_value(ts, item_offset, false);
+}
+
+int thingset_import_record(struct thingset_context *ts, const uint8_t *data, size_t len,
+                           struct thingset_endpoint *endpoint, enum thingset_data_format format)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->msg = data;
+    ts->msg_len = len;
+    ts->msg_pos = 0;
+    ts->rsp = NULL;
+    ts->rsp_size = 0;
+    ts->rsp_pos = 0;
+
+    ts->endpoint = *endpoint;
+
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            thingset_txt_setup(ts);
+            ts->msg_payload = data;
+            ts->api->deserialize_payload_reset(ts);
+            break;
+#endif
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 0);
+            ts->msg_payload = data;
+            ts->api->deserialize_payload_reset(ts);
+            break;
+        default:
+            err = -THINGSET_ERR_NOT_IMPLEMENTED;
+            goto out;
+    }
+
+    err = ts->api->deserialize_map_start(ts);
+    if (err != 0) {
+        goto out;
+    }
+
+    const struct thingset_data_object *item;
+    while ((err = ts->api->deserialize_child(ts, &item)) != -THINGSET_ERR_DESERIALIZATION_FINISHED)
+    {
+        if (err == -THINGSET_ERR_NOT_FOUND) {
+            /* silently ignore non-existing record items and skip value */
+            ts->api->deserialize_skip(ts);
+            continue;
+        }
+        else if (err != 0) {
+            goto out;
+        }
+
+        struct thingset_records *records = ts->endpoint.object->data.records;
+        uint8_t *record_ptr =
+            (uint8_t *)records->records + ts->endpoint.index * records->record_size;
+        err = thingset_common_prepare_record_element(ts, item, record_ptr,
+                                                     deserialize_value_callback);
+
+        if (err != 0) {
+            goto out;
+        }
+    }
+
+    err = err == -THINGSET_ERR_DESERIALIZATION_FINISHED ? 0 : ts->api->deserialize_finish(ts);
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    if (err == 0) {
+        /* record items are no data objects on their own, so the records object is stamped */
+        thingset_object_changed(ts, ts->endpoint.object);
+    }
+#endif
+
+out:
+    k_sem_give(&ts->lock);
+
+    return err;
+}
+
+static int report_setup(struct thingset_context *ts, enum thingset_data_format format)
+{
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            thingset_txt_setup(ts);
+            break;
+#endif
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 1);
+            break;
+        case THINGSET_BIN_NAMES_VALUES:
+            ts->endpoint.use_ids = false;
+            thingset_bin_setup(ts, 1);
+            break;
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+        case THINGSET_BIN_IDS_VALUES_FIXED_WIDTH:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 1);
+            ts->bin_fixed_width = true;
+            break;
+#endif
+        default:
+            return -THINGSET_ERR_NOT_IMPLEMENTED;
+    }
+
+    return 0;
+}
+
+static int report_path(struct thingset_context *ts, char *buf, size_t buf_size, const char *path,
+                       enum thingset_data_format format)
+{
+    int err;
+
+    ts->rsp = buf;
+    ts->rsp_size = buf_size;
+    ts->rsp_pos = 0;
+
+    err = thingset_endpoint_by_path(ts, &ts->endpoint, path, strlen(path));
+    if (err != 0) {
+        return err;
+    }
+    else if (ts->endpoint.object == NULL) {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    err = report_setup(ts, format);
+    if (err != 0) {
+        return err;
+    }
+
+    err = ts->api->serialize_report_header(ts, path);
+    if (err != 0) {
+        return err;
+    }
+
+    switch (ts->endpoint.object->type) {
+        case THINGSET_TYPE_GROUP:
+            err = thingset_common_serialize_group(ts, ts->endpoint.object);
+            break;
+        case THINGSET_TYPE_SUBSET:
+            err = ts->api->serialize_subsets(ts, ts->endpoint.object->data.subset);
+            break;
+        case THINGSET_TYPE_FN_VOID:
+        case THINGSET_TYPE_FN_I32:
+            /* bad request, as we can't read exec object's values */
+            err = -THINGSET_ERR_BAD_REQUEST;
+            break;
+        case THINGSET_TYPE_RECORDS:
+            if (ts->endpoint.index != THINGSET_ENDPOINT_INDEX_NONE) {
+                err = thingset_common_serialize_record(ts, ts->endpoint.object, ts->endpoint.index,
+                                                       THINGSET_NUM_ELEMENTS_UNKNOWN);
+                break;
+            }
+            /* fallthrough */
+        default:
+            err = ts->api->serialize_value(ts, ts->endpoint.object);
+            break;
+    }
+
+    ts->api->serialize_finish(ts);
+
+    if (err == 0) {
+        err = ts->rsp_pos;
+    }
+
+    return err;
+}
+
+int thingset_report_path(struct thingset_context *ts, char *buf, size_t buf_size, const char *path,
+                         enum thingset_data_format format)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    err = report_path(ts, buf, buf_size, path, format);
+
+    k_sem_give(&ts->lock);
+
+    return err;
+}
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+
+int thingset_sink_flush(struct thingset_context *ts, size_t len, size_t keep)
+{
+    int err = ts->sink->flush(ts->rsp, len - keep, ts->sink->user_data);
+    if (err != 0) {
+        return err;
+    }
+
+    memmove(ts->rsp, ts->rsp + len - keep, keep);
+    ts->sink_flushed += len - keep;
+
+    return 0;
+}
+
+/* flush the remaining data after serialization into the staging buffer was finished */
+static int sink_finish(struct thingset_context *ts, int ret)
+{
+    if (ret > 0) {
+        ret = thingset_sink_flush(ts, ret, 0);
+    }
+
+    if (ret == 0) {
+        ret = ts->sink_flushed;
+    }
+
+    ts->sink = NULL;
+
+    return ret;
+}
+
+int thingset_export_subsets_to_sink(struct thingset_context *ts, const struct thingset_sink *sink,
+                                    uint16_t subsets, enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->sink = sink;
+    ts->sink_flushed = 0;
+    ts->sink_report = false;
+
+    ret = export_subsets(ts, sink->buf, sink->size, subsets, format);
+    ret = sink_finish(ts, ret);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+int thingset_report_path_to_sink(struct thingset_context *ts, const struct thingset_sink *sink,
+                                 const char *path, enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->sink = sink;
+    ts->sink_flushed = 0;
+    ts->sink_report = true;
+
+    ret = report_path(ts, (char *)sink->buf, sink->size, path, format);
+    ret = sink_finish(ts, ret);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+#endif /* CONFIG_THINGSET_STREAMING_SINK */
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+static int export_size(struct thingset_context *ts, uint16_t subsets,
+                       enum thingset_data_format format, bool max)
+{
+    /* nothing is serialized, but the setup of the encoder requires a valid buffer */
+    uint8_t buf[1];
+    int ret;
+
+    ts->rsp = buf;
+    ts->rsp_size = sizeof(buf);
+    ts->rsp_pos = 0;
+
+    ret = export_setup(ts, format);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ret = ts->api->subsets_size(ts, subsets, false, max);
+
+    /* the trailing comma of text mode is removed by serialize_finish */
+    return !max && format == THINGSET_TXT_NAMES_VALUES ? ret - 1 : ret;
+}
+
+static int report_size(struct thingset_context *ts, const char *path,
+                       enum thingset_data_format format, bool max)
+{
+    /* nothing is serialized, but the setup of the encoder requires a valid buffer */
+    uint8_t buf[1];
+    const struct thingset_data_object *object;
+    int err;
+
+    ts->rsp = buf;
+    ts->rsp_size = sizeof(buf);
+    ts->rsp_pos = 0;
+
+    err = thingset_endpoint_by_path(ts, &ts->endpoint, path, strlen(path));
+    if (err != 0) {
+        return err;
+    }
+    else if (ts->endpoint.object == NULL) {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    err = report_setup(ts, format);
+    if (err != 0) {
+        return err;
+    }
+
+    object = ts->endpoint.object;
+    size_t len = ts->api->report_header_size(ts, path, max);
+
+    /* same distinction of object types as in report_path */
+    switch (object->type) {
+        case THINGSET_TYPE_GROUP:
+            len += thingset_common_group_size(ts, object, true, max);
+            break;
+        case THINGSET_TYPE_SUBSET:
+            len += ts->api->subsets_size(ts, object->data.subset, true, max);
+            break;
+        case THINGSET_TYPE_FN_VOID:
+        case THINGSET_TYPE_FN_I32:
+            return -THINGSET_ERR_BAD_REQUEST;
+        case THINGSET_TYPE_RECORDS:
+            if (ts->endpoint.index != THINGSET_ENDPOINT_INDEX_NONE) {
+                if (!max && ts->endpoint.index >= object->data.records->num_records) {
+                    return -THINGSET_ERR_NOT_FOUND;
+                }
+                len += thingset_common_record_size(ts, object, ts->endpoint.index, true, max);
+                break;
+            }
+            /* fallthrough */
+        default:
+            len += ts->api->value_size(ts, object, true, max);
+            break;
+    }
+
+    /* the trailing comma of text mode is removed by serialize_finish */
+    return !max && format == THINGSET_TXT_NAMES_VALUES ? len - 1 : len;
+}
+
+int thingset_export_size(struct thingset_context *ts, uint16_t subsets,
+                         enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ret = export_size(ts, subsets, format, false);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+int thingset_report_size(struct thingset_context *ts, const char *path,
+                         enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ret = report_size(ts, path, format, false);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+int thingset_export_size_max(struct thingset_context *ts, uint16_t subsets,
+                             enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ret = export_size(ts, subsets, format, true);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+int thingset_report_size_max(struct thingset_context *ts, const char *path,
+                             enum thingset_data_format format)
+{
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ret = report_size(ts, path, format, true);
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+
+int thingset_iovec_append(struct thingset_context *ts, const uint8_t *end, const uint8_t *base,
+                          size_t len)
+{
+    if (end > ts->iov_pending) {
+        if (ts->iov_count >= ts->iov_max) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        ts->iov[ts->iov_count].base = ts->iov_pending;
+        ts->iov[ts->iov_count].len = end - ts->iov_pending;
+        ts->iov_count++;
+        ts->iov_pending = end;
+    }
+
+    if (base != NULL) {
+        if (ts->iov_count >= ts->iov_max) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        ts->iov[ts->iov_count].base = base;
+        ts->iov[ts->iov_count].len = len;
+        ts->iov_count++;
+    }
+
+    return 0;
+}
+
+int thingset_export_subsets_iovec(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                                  struct thingset_iovec *iov, size_t iov_max, uint16_t subsets,
+                                  enum thingset_data_format format)
+{
+    int ret;
+
+    if (format != THINGSET_BIN_IDS_VALUES) {
+        return -THINGSET_ERR_NOT_IMPLEMENTED;
+    }
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    ts->iov = iov;
+    ts->iov_max = iov_max;
+    ts->iov_count = 0;
+    ts->iov_pending = buf;
+
+    ret = export_subsets(ts, buf, buf_size, subsets, format);
+    if (ret >= 0) {
+        /* store the data serialized after the last referenced value */
+        ret = thingset_iovec_append(ts, buf + ret, NULL, 0);
+    }
+    if (ret == 0) {
+        ret = ts->iov_count;
+    }
+
+    ts->iov = NULL;
+
+    k_sem_give(&ts->lock);
+
+    return ret;
+}
+
+#endif /* CONFIG_THINGSET_EXPORT_IOVEC */
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+static int report_template_setup(struct thingset_context *ts, enum thingset_data_format format)
+{
+    switch (format) {
+#ifdef CONFIG_THINGSET_TEXT_MODE
+        case THINGSET_TXT_NAMES_VALUES:
+            thingset_txt_setup(ts);
+            return 0;
+#endif
+        case THINGSET_BIN_IDS_VALUES:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 1);
+            return 0;
+        case THINGSET_BIN_NAMES_VALUES:
+            ts->endpoint.use_ids = false;
+            thingset_bin_setup(ts, 1);
+            return 0;
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+        case THINGSET_BIN_IDS_VALUES_FIXED_WIDTH:
+            ts->endpoint.use_ids = true;
+            thingset_bin_setup(ts, 1);
+            ts->bin_fixed_width = true;
+            return 0;
+#endif
+        default:
+            return -THINGSET_ERR_NOT_IMPLEMENTED;
+    }
+}
+
+/* determine the subset members and serialize the header (if path is not NULL) and keys */
+static int report_template_update(struct thingset_context *ts,
+                                  struct thingset_report_template *tmpl, const char *path)
+{
+    uint16_t subsets = tmpl->object->data.subset;
+    unsigned int num_members = 0;
+    int err;
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        if (num_members >= ARRAY_SIZE(tmpl->members)) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        tmpl->members[num_members++] = i;
+    }
+    tmpl->num_members = num_members;
+
+    ts->rsp = tmpl->data;
+    ts->rsp_size = sizeof(tmpl->data);
+    ts->rsp_pos = 0;
+
+    ts->endpoint.object = tmpl->object;
+    ts->endpoint.index = THINGSET_ENDPOINT_INDEX_NONE;
+
+    err = report_template_setup(ts, tmpl->format);
+    if (err != 0) {
+        return err;
+    }
+
+    err = ts->api->prepare_report_template(ts, tmpl, path);
+    if (err == 0) {
+        tmpl->generation = ts->subsets_generation;
+    }
+
+    return err;
+}
+
+int thingset_report_prepare(struct thingset_context *ts, const char *path,
+                            enum thingset_data_format format,
+                            struct thingset_report_template *tmpl)
+{
+    int err;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    build_indices_lazy(ts);
+
+    err = thingset_endpoint_by_path(ts, &ts->endpoint, path, strlen(path));
+    if (err != 0) {
+        goto out;
+    }
+    else if (ts->endpoint.object == NULL || ts->endpoint.object->type != THINGSET_TYPE_SUBSET) {
+        /* only subsets have a fixed set of keys */
+        err = -THINGSET_ERR_BAD_REQUEST;
+        goto out;
     }
 
-    return ret;
+    tmpl->ts = ts;
+    tmpl->object = ts->endpoint.object;
+    tmpl->format = format;
+
+    err = report_template_update(ts, tmpl, path);
+
+out:
+    k_sem_give(&ts->lock);
+
+    return err;
 }
 
-int thingset_export_subsets(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
-                            uint16_t subsets, enum thingset_data_format format)
+static int report_template_render(struct thingset_context *ts,
+                                  struct thingset_report_template *tmpl, char *buf,
+                                  size_t buf_size)
 {
-    int ret;
+    int err;
 
-    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
-        LOG_ERR("ThingSet context lock timed out");
-        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    if (tmpl->generation != ts->subsets_generation) {
+        err = report_template_update(ts, tmpl, NULL);
+        if (err != 0) {
+            return err;
+        }
     }
 
     ts->rsp = buf;
     ts->rsp_size = buf_size;
     ts->rsp_pos = 0;
 
-    switch (format) {
-#ifdef CONFIG_THINGSET_TEXT_MODE
-        case THINGSET_TXT_NAMES_VALUES:
-            thingset_txt_setup(ts);
-            break;
-#endif
-        case THINGSET_BIN_IDS_VALUES:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 0);
-            break;
-        default:
-            return -THINGSET_ERR_NOT_IMPLEMENTED;
+    ts->endpoint.object = tmpl->object;
+    ts->endpoint.index = THINGSET_ENDPOINT_INDEX_NONE;
+
+    err = report_template_setup(ts, tmpl->format);
+    if (err != 0) {
+        return err;
     }
 
-    ret = ts->api->serialize_subsets(ts, subsets);
+    err = ts->api->serialize_report_template(ts, tmpl);
+    if (err != 0) {
+        return err;
+    }
 
     ts->api->serialize_finish(ts);
 
-    if (ret == 0) {
-        ret = ts->rsp_pos;
+    return ts->rsp_pos;
+}
+
+int thingset_report_render(struct thingset_report_template *tmpl, char *buf, size_t buf_size)
+{
+    struct thingset_context *ts = tmpl->ts;
+    int ret;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
+    build_indices_lazy(ts);
+
+    ret = report_template_render(ts, tmpl, buf, buf_size);
+
     k_sem_give(&ts->lock);
 
     return ret;
 }
 
-int thingset_export_item(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
-                         const struct thingset_data_object *obj, enum thingset_data_format format)
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+int thingset_report_patch(struct thingset_report_template *tmpl, char *buf, size_t buf_size)
 {
+    struct thingset_context *ts = tmpl->ts;
     int ret;
 
+    if (tmpl->format != THINGSET_BIN_IDS_VALUES_FIXED_WIDTH) {
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
     if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
         LOG_ERR("ThingSet context lock timed out");
         return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
+    build_indices_lazy(ts);
+
+    if (tmpl->generation != ts->subsets_generation) {
+        /* keys have changed, so the values have to be moved */
+        ret = report_template_render(ts, tmpl, buf, buf_size);
+        goto out;
+    }
+
     ts->rsp = buf;
     ts->rsp_size = buf_size;
     ts->rsp_pos = 0;
 
-    switch (format) {
-#ifdef CONFIG_THINGSET_TEXT_MODE
-        case THINGSET_TXT_VALUES_ONLY:
-            thingset_txt_setup(ts);
-            break;
-#endif
-        case THINGSET_BIN_VALUES_ONLY:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 0);
-            break;
-        default:
-            ret = -THINGSET_ERR_NOT_IMPLEMENTED;
-            goto out;
+    ret = report_template_setup(ts, tmpl->format);
+    if (ret != 0) {
+        goto out;
     }
 
-    ret = ts->api->serialize_value(ts, obj);
-
-    ts->api->serialize_finish(ts);
-
+    ret = thingset_bin_patch_report(ts, tmpl);
     if (ret == 0) {
         ret = ts->rsp_pos;
     }
@@ -247,305 +2195,166 @@ out:
     return ret;
 }
 
-struct thingset_data_object *thingset_iterate_subsets(struct thingset_context *ts, uint16_t subset,
-                                                      struct thingset_data_object *start_obj)
-{
-    if (start_obj == NULL) {
-        start_obj = ts->data_objects;
-    }
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
 
-    struct thingset_data_object *end_obj = ts->data_objects + ts->num_objects;
-    for (struct thingset_data_object *obj = start_obj; obj < end_obj; obj++) {
-        if (obj->subsets & subset) {
-            return obj;
-        }
-    }
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
 
-    return NULL;
-}
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
 
-int thingset_import_data_progressively(struct thingset_context *ts, const uint8_t *data, size_t len,
-                                       enum thingset_data_format format, uint8_t auth_flags,
-                                       uint32_t *last_id, size_t *consumed)
+void thingset_object_changed(struct thingset_context *ts,
+                             const struct thingset_data_object *object)
 {
-    int err = 0;
-
-    if (*last_id == 0) {
-        if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
-            LOG_ERR("ThingSet context lock timed out");
-            return -THINGSET_ERR_INTERNAL_SERVER_ERR;
-        }
+    if (object >= ts->data_objects && object < ts->data_objects + ts->num_objects) {
+        unsigned int index = object - ts->data_objects;
 
-        ts->msg = data;
-        ts->msg_len = len;
-        ts->msg_pos = 0;
-        ts->rsp = NULL;
-        ts->rsp_size = 0;
-        ts->rsp_pos = 0;
-
-        switch (format) {
-            case THINGSET_BIN_IDS_VALUES:
-                ts->endpoint.use_ids = true;
-                thingset_bin_setup(ts, 0);
-                ts->msg_payload = data;
-                ts->api->deserialize_payload_reset(ts);
-                break;
-            default:
-                err = -THINGSET_ERR_NOT_IMPLEMENTED;
-                k_sem_give(&ts->lock);
-                break;
-        }
-
-        if (err) {
-            return err;
+        ts->data_version++;
+        if (index < ARRAY_SIZE(ts->object_versions)) {
+            ts->object_versions[index] = ts->data_version;
         }
     }
-
-    err = thingset_bin_import_data_progressively(ts, auth_flags, len, last_id, consumed);
-    if (err < 0) {
-        k_sem_give(&ts->lock);
-    }
-    return err;
 }
 
-int thingset_import_data_progressively_end(struct thingset_context *ts)
+unsigned int thingset_next_changed_object(struct thingset_context *ts, uint32_t version,
+                                          unsigned int index)
 {
-    k_sem_give(&ts->lock);
-    return 0;
+    while (index < ts->num_objects && object_version_at(ts, index) <= version) {
+        index++;
+    }
+
+    return index;
 }
 
-int thingset_import_data(struct thingset_context *ts, const uint8_t *data, size_t len,
-                         uint8_t auth_flags, enum thingset_data_format format)
+int thingset_export_subsets_changes(struct thingset_context *ts, uint8_t *buf, size_t buf_size,
+                                    uint16_t subsets, enum thingset_data_format format,
+                                    uint32_t *version)
 {
-    int err;
+    int ret = 0;
 
     if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
         LOG_ERR("ThingSet context lock timed out");
         return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
-    ts->msg = data;
-    ts->msg_len = len;
-    ts->msg_pos = 0;
-    ts->rsp = NULL;
-    ts->rsp_size = 0;
-    ts->rsp_pos = 0;
-
-    switch (format) {
-        case THINGSET_BIN_IDS_VALUES:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 0);
-            ts->msg_payload = data;
-            ts->api->deserialize_payload_reset(ts);
-            err = thingset_bin_import_data(ts, auth_flags, format);
-            break;
-        default:
-            err = -THINGSET_ERR_NOT_IMPLEMENTED;
-            break;
-    }
-
-    k_sem_give(&ts->lock);
-
-    return err;
-}
+    build_indices_lazy(ts);
 
-int thingset_import_report(struct thingset_context *ts, const uint8_t *data, size_t len,
-                           uint8_t auth_flags, enum thingset_data_format format, uint16_t subset)
-{
-    int err;
+    ts->changes_since = *version;
 
-    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
-        LOG_ERR("ThingSet context lock timed out");
-        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    if (thingset_next_subset_member(ts, subsets, 0) < ts->num_objects) {
+        ret = export_subsets(ts, buf, buf_size, subsets, format);
     }
 
-    ts->msg = data;
-    ts->msg_len = len;
-    ts->msg_pos = 0;
-    ts->rsp = NULL;
-    ts->rsp_size = 0;
-    ts->rsp_pos = 0;
+    ts->changes_since = 0;
 
-    switch (format) {
-        case THINGSET_BIN_IDS_VALUES:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 0);
-            ts->decoder->elem_count = 2;
-            ts->msg_payload = data;
-            err = thingset_bin_import_report(ts, auth_flags, subset);
-            break;
-        default:
-            err = -THINGSET_ERR_NOT_IMPLEMENTED;
-            break;
+    if (ret >= 0) {
+        *version = ts->data_version;
     }
 
     k_sem_give(&ts->lock);
 
-    return err;
-}
-
-static int deserialize_value_callback(struct thingset_context *ts,
-                                      const struct thingset_data_object *item_offset)
-{
-    return ts->api->deserialize_value(ts, item_offset, false);
+    return ret;
 }
 
-int thingset_import_record(struct thingset_context *ts, const uint8_t *data, size_t len,
-                           struct thingset_endpoint *endpoint, enum thingset_data_format format)
+int thingset_report_path_changes(struct thingset_context *ts, char *buf, size_t buf_size,
+                                 const char *path, enum thingset_data_format format,
+                                 uint32_t *version)
 {
-    int err;
+    int ret;
 
     if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
         LOG_ERR("ThingSet context lock timed out");
         return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
-    ts->msg = data;
-    ts->msg_len = len;
-    ts->msg_pos = 0;
-    ts->rsp = NULL;
-    ts->rsp_size = 0;
-    ts->rsp_pos = 0;
-
-    ts->endpoint = *endpoint;
+    build_indices_lazy(ts);
 
-    switch (format) {
-#ifdef CONFIG_THINGSET_TEXT_MODE
-        case THINGSET_TXT_NAMES_VALUES:
-            thingset_txt_setup(ts);
-            ts->msg_payload = data;
-            ts->api->deserialize_payload_reset(ts);
-            break;
-#endif
-        case THINGSET_BIN_IDS_VALUES:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 0);
-            ts->msg_payload = data;
-            ts->api->deserialize_payload_reset(ts);
-            break;
-        default:
-            err = -THINGSET_ERR_NOT_IMPLEMENTED;
-            goto out;
+    ret = thingset_endpoint_by_path(ts, &ts->endpoint, path, strlen(path));
+    if (ret != 0) {
+        goto out;
     }
-
-    err = ts->api->deserialize_map_start(ts);
-    if (err != 0) {
+    else if (ts->endpoint.object == NULL || ts->endpoint.object->type != THINGSET_TYPE_SUBSET) {
+        /* changes can only be determined for subset members */
+        ret = -THINGSET_ERR_BAD_REQUEST;
         goto out;
     }
 
-    const struct thingset_data_object *item;
-    while ((err = ts->api->deserialize_child(ts, &item)) != -THINGSET_ERR_DESERIALIZATION_FINISHED)
-    {
-        if (err == -THINGSET_ERR_NOT_FOUND) {
-            /* silently ignore non-existing record items and skip value */
-            ts->api->deserialize_skip(ts);
-            continue;
-        }
-        else if (err != 0) {
-            goto out;
-        }
-
-        struct thingset_records *records = ts->endpoint.object->data.records;
-        uint8_t *record_ptr =
-            (uint8_t *)records->records + ts->endpoint.index * records->record_size;
-        err = thingset_common_prepare_record_element(ts, item, record_ptr,
-                                                     deserialize_value_callback);
+    ts->changes_since = *version;
 
-        if (err != 0) {
-            goto out;
-        }
+    if (thingset_next_subset_member(ts, ts->endpoint.object->data.subset, 0) < ts->num_objects) {
+        ret = report_path(ts, buf, buf_size, path, format);
     }
 
-    err = err == -THINGSET_ERR_DESERIALIZATION_FINISHED ? 0 : ts->api->deserialize_finish(ts);
+    ts->changes_since = 0;
+
+    if (ret >= 0) {
+        *version = ts->data_version;
+    }
 
 out:
     k_sem_give(&ts->lock);
 
-    return err;
+    return ret;
 }
 
-int thingset_report_path(struct thingset_context *ts, char *buf, size_t buf_size, const char *path,
-                         enum thingset_data_format format)
+int thingset_set_value(struct thingset_context *ts, thingset_object_id_t id, const void *value)
 {
-    int err;
+    int err = 0;
 
     if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
         LOG_ERR("ThingSet context lock timed out");
         return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
-    ts->rsp = buf;
-    ts->rsp_size = buf_size;
-    ts->rsp_pos = 0;
-
-    err = thingset_endpoint_by_path(ts, &ts->endpoint, path, strlen(path));
-    if (err != 0) {
+    build_indices_lazy(ts);
+
+    struct thingset_data_object *object = thingset_get_object_by_id(ts, id);
+    if (object == NULL) {
+        err = -THINGSET_ERR_NOT_FOUND;
         goto out;
     }
-    else if (ts->endpoint.object == NULL) {
-        err = -THINGSET_ERR_BAD_REQUEST;
+
+    size_t size = thingset_type_size(object->type);
+    if (size == 0) {
+        err = -THINGSET_ERR_UNSUPPORTED_FORMAT;
         goto out;
     }
 
-    switch (format) {
-#ifdef CONFIG_THINGSET_TEXT_MODE
-        case THINGSET_TXT_NAMES_VALUES:
-            thingset_txt_setup(ts);
-            break;
-#endif
-        case THINGSET_BIN_IDS_VALUES:
-            ts->endpoint.use_ids = true;
-            thingset_bin_setup(ts, 1);
-            break;
-        case THINGSET_BIN_NAMES_VALUES:
-            ts->endpoint.use_ids = false;
-            thingset_bin_setup(ts, 1);
-            break;
-        default:
-            err = -THINGSET_ERR_NOT_IMPLEMENTED;
-            goto out;
+    if (memcmp(object->data.u8, value, size) != 0) {
+        memcpy(object->data.u8, value, size);
+        thingset_object_changed(ts, object);
     }
 
-    err = ts->api->serialize_report_header(ts, path);
-    if (err != 0) {
-        goto out;
-    }
+out:
+    k_sem_give(&ts->lock);
 
-    switch (ts->endpoint.object->type) {
-        case THINGSET_TYPE_GROUP:
-            err = thingset_common_serialize_group(ts, ts->endpoint.object);
-            break;
-        case THINGSET_TYPE_SUBSET:
-            err = ts->api->serialize_subsets(ts, ts->endpoint.object->data.subset);
-            break;
-        case THINGSET_TYPE_FN_VOID:
-        case THINGSET_TYPE_FN_I32:
-            /* bad request, as we can't read exec object's values */
-            err = -THINGSET_ERR_BAD_REQUEST;
-            break;
-        case THINGSET_TYPE_RECORDS:
-            if (ts->endpoint.index != THINGSET_ENDPOINT_INDEX_NONE) {
-                err = thingset_common_serialize_record(ts, ts->endpoint.object, ts->endpoint.index);
-                break;
-            }
-            /* fallthrough */
-        default:
-            err = ts->api->serialize_value(ts, ts->endpoint.object);
-            break;
+    return err;
+}
+
+int thingset_mark_changed(struct thingset_context *ts, thingset_object_id_t id)
+{
+    int err = 0;
+
+    if (k_sem_take(&ts->lock, K_MSEC(THINGSET_CONTEXT_LOCK_TIMEOUT_MS)) != 0) {
+        LOG_ERR("ThingSet context lock timed out");
+        return -THINGSET_ERR_INTERNAL_SERVER_ERR;
     }
 
-    ts->api->serialize_finish(ts);
+    build_indices_lazy(ts);
 
-    if (err == 0) {
-        err = ts->rsp_pos;
+    struct thingset_data_object *object = thingset_get_object_by_id(ts, id);
+    if (object != NULL) {
+        thingset_object_changed(ts, object);
+    }
+    else {
+        err = -THINGSET_ERR_NOT_FOUND;
     }
 
-out:
     k_sem_give(&ts->lock);
 
     return err;
 }
 
+#endif /* CONFIG_THINGSET_CHANGE_TRACKING */
+
 void thingset_set_authentication(struct thingset_context *ts, uint8_t flags)
 {
     ts->auth_flags = flags;
@@ -558,12 +2367,14 @@ void thingset_set_update_callback(struct thingset_context *ts, const uint16_t su
     ts->update_cb = update_cb;
 }
 
-struct thingset_data_object *thingset_get_child_by_name(struct thingset_context *ts,
-                                                        uint16_t parent_id, const char *name,
-                                                        size_t len)
+static struct thingset_data_object *search_child_by_name(struct thingset_context *ts,
+                                                         uint16_t parent_id, const char *name,
+                                                         size_t len)
 {
+    bool hot = hot_arrays_available(ts);
+
     for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].parent_id == parent_id
+        if (object_parent_id_at(ts, hot, i) == parent_id
             && strncmp(ts->data_objects[i].name, name, len) == 0
             // without length check foo and fooBar would be recognized as equal
             && strlen(ts->data_objects[i].name) == len)
@@ -572,44 +2383,321 @@ struct thingset_data_object *thingset_get_child_by_name(struct thingset_context
         }
     }
 
+    return NULL;
+}
+
+struct thingset_data_object *thingset_get_child_by_name(struct thingset_context *ts,
+                                                        uint16_t parent_id, const char *name,
+                                                        size_t len)
+{
+    struct thingset_data_object *object;
+
+#ifdef CONFIG_THINGSET_NAME_INDEX
+    if (index_available(ts)) {
+        object = name_index_lookup(ts, parent_id, name, len);
+    }
+    else {
+        object = search_child_by_name(ts, parent_id, name, len);
+    }
+#else
+    object = search_child_by_name(ts, parent_id, name, len);
+#endif
+
+    if (object != NULL) {
+        return object;
+    }
+
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
     if (len == strlen(metadata_object.name) && strncmp(name, metadata_object.name, len) == 0) {
         return &metadata_object;
     }
 #endif
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    if (len == strlen(changes_object.name) && strncmp(name, changes_object.name, len) == 0) {
+        return &changes_object;
+    }
+#endif
+
     return NULL;
 }
 
-struct thingset_data_object *thingset_get_object_by_id(struct thingset_context *ts, uint16_t id)
+struct thingset_data_object *thingset_get_next_child(struct thingset_context *ts,
+                                                     const struct thingset_data_object *parent,
+                                                     unsigned int *pos)
 {
-#ifdef CONFIG_THINGSET_OBJECT_LOOKUP_MAP
-    sys_slist_t *list = &ts->data_objects_lookup[id % CONFIG_THINGSET_OBJECT_LOOKUP_BUCKETS];
-    sys_snode_t *pnode;
-    struct thingset_data_object *object;
-    SYS_SLIST_FOR_EACH_NODE(list, pnode)
+#ifdef CONFIG_THINGSET_CHILD_INDEX
+    if (index_available(ts)) {
+        if (*pos < ts->num_objects) {
+            struct thingset_data_object *child = &ts->data_objects[ts->child_index[*pos]];
+            if (child->parent_id == parent->id) {
+                (*pos)++;
+                return child;
+            }
+        }
+        return NULL;
+    }
+#endif
+
+    bool hot = hot_arrays_available(ts);
+
+    while (*pos < ts->num_objects) {
+        unsigned int i = (*pos)++;
+        if (object_parent_id_at(ts, hot, i) == parent->id) {
+            return &ts->data_objects[i];
+        }
+    }
+
+    return NULL;
+}
+
+struct thingset_data_object *thingset_get_first_child(struct thingset_context *ts,
+                                                      const struct thingset_data_object *parent,
+                                                      unsigned int *pos)
+{
+    *pos = 0;
+
+#ifdef CONFIG_THINGSET_CHILD_INDEX
+    if (index_available(ts)) {
+        if (parent >= ts->data_objects && parent < ts->data_objects + ts->num_objects) {
+            *pos = ts->child_offsets[parent - ts->data_objects];
+        }
+        else {
+            /* root object or temporary copy of an object (e.g. for records) */
+            *pos = child_index_lower_bound(ts, parent->id);
+        }
+    }
+#endif
+
+    return thingset_get_next_child(ts, parent, pos);
+}
+
+struct thingset_data_object *thingset_get_next_record_field(
+    struct thingset_context *ts, const struct thingset_data_object *records, unsigned int *pos)
+{
+#ifdef CONFIG_THINGSET_RECORD_FIELD_CACHE
+    if (ts->record_fields_valid) {
+        if (*pos < ARRAY_SIZE(ts->record_fields) && ts->record_fields[*pos] != RECORD_FIELDS_END) {
+            return &ts->data_objects[ts->record_fields[(*pos)++]];
+        }
+        return NULL;
+    }
+#endif
+
+    return thingset_get_next_child(ts, records, pos);
+}
+
+struct thingset_data_object *thingset_get_first_record_field(
+    struct thingset_context *ts, const struct thingset_data_object *records, unsigned int *pos)
+{
+#ifdef CONFIG_THINGSET_RECORD_FIELD_CACHE
+    if (ts->record_fields_valid) {
+        *pos = record_fields_find(ts, records->id);
+        return thingset_get_next_record_field(ts, records, pos);
+    }
+#endif
+
+    return thingset_get_first_child(ts, records, pos);
+}
+
+size_t thingset_count_record_fields(struct thingset_context *ts,
+                                    const struct thingset_data_object *records)
+{
+    size_t count = 0;
+    unsigned int pos;
+
+    for (struct thingset_data_object *field = thingset_get_first_record_field(ts, records, &pos);
+         field != NULL; field = thingset_get_next_record_field(ts, records, &pos))
     {
-        object = CONTAINER_OF(pnode, struct thingset_data_object, node);
-        if (object->id == id) {
-            return object;
+        count++;
+    }
+
+    return count;
+}
+
+static unsigned int next_subset_member(struct thingset_context *ts, uint16_t subsets,
+                                       unsigned int index)
+{
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+    if (ts->subset_index_valid) {
+        unsigned int next = ts->num_objects;
+        for (unsigned int bit = 0; bit < THINGSET_NUM_SUBSETS; bit++) {
+            if (subsets & (1U << bit)) {
+                unsigned int pos = subset_lower_bound(ts, bit, index);
+                if (pos < ts->subset_offsets[bit + 1] && ts->subset_members[pos] < next) {
+                    next = ts->subset_members[pos];
+                }
+            }
         }
+        return next;
     }
-#else
+#endif
+
+    bool hot = hot_arrays_available(ts);
+
+    while (index < ts->num_objects && !(object_subsets_at(ts, hot, index) & subsets)) {
+        index++;
+    }
+
+    return index;
+}
+
+unsigned int thingset_next_subset_member(struct thingset_context *ts, uint16_t subsets,
+                                         unsigned int index)
+{
+    index = next_subset_member(ts, subsets, index);
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    while (index < ts->num_objects && object_version_at(ts, index) <= ts->changes_since) {
+        index = next_subset_member(ts, subsets, index + 1);
+    }
+#endif
+
+    return index;
+}
+
+size_t thingset_count_subset_members(struct thingset_context *ts, uint16_t subsets)
+{
+    size_t count = 0;
+
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+    if (ts->subset_index_valid && !subset_changes_only(ts)) {
+        for (unsigned int bit = 0; bit < THINGSET_NUM_SUBSETS; bit++) {
+            if (subsets == (1U << bit)) {
+                /* no need to check for objects belonging to multiple selected subsets */
+                return ts->subset_offsets[bit + 1] - ts->subset_offsets[bit];
+            }
+        }
+    }
+#endif
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+#ifndef CONFIG_THINGSET_IMMUTABLE_OBJECTS
+
+void thingset_set_object_subsets(struct thingset_context *ts, struct thingset_data_object *object,
+                                 uint16_t subsets)
+{
+#ifdef CONFIG_THINGSET_SUBSET_INDEX
+    if (ts->subset_index_valid && object >= ts->data_objects
+        && object < ts->data_objects + ts->num_objects)
+    {
+        uint16_t index = object - ts->data_objects;
+        for (unsigned int bit = 0; bit < THINGSET_NUM_SUBSETS; bit++) {
+            uint16_t mask = 1U << bit;
+            if ((subsets & mask) && !(object->subsets & mask)) {
+                if (ts->subset_offsets[THINGSET_NUM_SUBSETS] >= ARRAY_SIZE(ts->subset_members)) {
+                    LOG_WRN("Subset index too small, using linear search");
+                    ts->subset_index_valid = false;
+                    break;
+                }
+                subset_index_insert(ts, bit, index);
+            }
+            else if (!(subsets & mask) && (object->subsets & mask)) {
+                subset_index_remove(ts, bit, index);
+            }
+        }
+    }
+#endif
+
+#ifdef CONFIG_THINGSET_OBJECT_HOT_ARRAYS
+    if (index_available(ts) && object >= ts->data_objects
+        && object < ts->data_objects + ts->num_objects)
+    {
+        ts->hot_subsets[object - ts->data_objects] = subsets;
+    }
+#endif
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    ts->subsets_generation++;
+#endif
+
+    object->subsets = subsets;
+}
+
+#endif /* CONFIG_THINGSET_IMMUTABLE_OBJECTS */
+
+/* lookup by ID using the index if indicated as available by the caller */
+static struct thingset_data_object *find_object_by_id(struct thingset_context *ts, uint16_t id,
+                                                      bool indexed)
+{
+#if defined(CONFIG_THINGSET_OBJECT_LOOKUP_MAP)
+    if (indexed) {
+        unsigned int mask = (1U << ts->data_objects_lookup_bits) - 1;
+        for (unsigned int slot = hash_table_slot(id, ts->data_objects_lookup_bits);
+             ts->data_objects_lookup[slot] != HASH_TABLE_EMPTY; slot = (slot + 1) & mask)
+        {
+            struct thingset_data_object *object = &ts->data_objects[ts->data_objects_lookup[slot]];
+            if (object->id == id) {
+                return object;
+            }
+        }
+        return NULL;
+    }
+#elif defined(CONFIG_THINGSET_ID_INDEX)
+    if (indexed) {
+        unsigned int low = 0;
+        unsigned int high = ts->num_objects;
+        while (low < high) {
+            unsigned int mid = low + (high - low) / 2;
+            struct thingset_data_object *object = &ts->data_objects[ts->id_index[mid]];
+            if (object->id == id) {
+                return object;
+            }
+            else if (object->id < id) {
+                low = mid + 1;
+            }
+            else {
+                high = mid;
+            }
+        }
+        return NULL;
+    }
+#endif
+
+    bool hot = hot_arrays_available(ts);
+
     for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].id == id) {
+        if (object_id_at(ts, hot, i) == id) {
             return &(ts->data_objects[i]);
         }
     }
-#endif /* CONFIG_THINGSET_OBJECT_LOOKUP_MAP */
+
     return NULL;
 }
 
+struct thingset_data_object *thingset_get_object_by_id(struct thingset_context *ts, uint16_t id)
+{
+#if defined(CONFIG_THINGSET_OBJECT_LOOKUP_MAP) || defined(CONFIG_THINGSET_ID_INDEX)
+    return find_object_by_id(ts, id, index_available(ts));
+#else
+    return find_object_by_id(ts, id, false);
+#endif
+}
+
 struct thingset_data_object *thingset_get_object_by_path(struct thingset_context *ts,
                                                          const char *path, size_t path_len,
                                                          int *index)
 {
     *index = THINGSET_ENDPOINT_INDEX_NONE;
 
+#ifdef CONFIG_THINGSET_PATH_INDEX
+    if (index_available(ts)) {
+        /* paths with record index or trailing slash are not found and parsed below */
+        struct thingset_data_object *object = path_index_lookup(ts, path, path_len);
+        if (object != NULL) {
+            return object;
+        }
+    }
+#endif
+
     struct thingset_data_object *object = NULL;
     const char *start = path;
     const char *end;
@@ -617,8 +2705,9 @@ struct thingset_data_object *thingset_get_object_by_path(struct thingset_context
 
     /* maximum depth of 10 assumed */
     for (int i = 0; i < 10; i++) {
-        end = strchr(start, '/');
-        if (end == NULL || end >= path + path_len) {
+        /* path is not necessarily null-terminated (e.g. from CBOR or JSON payloads) */
+        end = memchr(start, '/', path + path_len - start);
+        if (end == NULL) {
             /* reached at the end of the path */
             if (object != NULL && object->type == THINGSET_TYPE_RECORDS && *start >= '0'
                 && *start <= '9')
@@ -685,6 +2774,17 @@ int thingset_endpoint_by_path(struct thingset_context *ts, struct thingset_endpo
         return -THINGSET_ERR_NOT_A_GATEWAY;
     }
 
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+    uint32_t hash = 0;
+    bool cacheable = path_len <= CONFIG_THINGSET_ENDPOINT_CACHE_PATH_LEN;
+    if (cacheable) {
+        hash = fnv1a_hash(FNV1A_OFFSET_BASIS, path, path_len);
+        if (endpoint_cache_get(ts, endpoint, path, path_len, hash)) {
+            return 0;
+        }
+    }
+#endif
+
     struct thingset_data_object *object =
         thingset_get_object_by_path(ts, path, path_len, &endpoint->index);
 
@@ -694,6 +2794,12 @@ int thingset_endpoint_by_path(struct thingset_context *ts, struct thingset_endpo
         return -THINGSET_ERR_NOT_FOUND;
     }
 
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+    if (cacheable) {
+        endpoint_cache_put(ts, endpoint, path, path_len, hash);
+    }
+#endif
+
     return 0;
 }
 
@@ -718,6 +2824,12 @@ int thingset_endpoint_by_id(struct thingset_context *ts, struct thingset_endpoin
         return 0;
     }
 #endif
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    else if (id == THINGSET_ID_CHANGES) {
+        endpoint->object = &changes_object;
+        return 0;
+    }
+#endif
 
     object = thingset_get_object_by_id(ts, id);
     if (object != NULL) {
@@ -734,9 +2846,34 @@ int thingset_endpoint_by_id(struct thingset_context *ts, struct thingset_endpoin
     return -THINGSET_ERR_NOT_FOUND;
 }
 
+size_t thingset_get_name_length(struct thingset_context *ts,
+                                const struct thingset_data_object *object)
+{
+#if defined(CONFIG_THINGSET_BINARY_KEY_CACHE) || defined(CONFIG_THINGSET_TEXT_KEY_CACHE)
+    if (ts->key_cache_valid && object >= ts->data_objects
+        && object < ts->data_objects + ts->num_objects)
+    {
+        uint8_t len = ts->key_name_lengths[object - ts->data_objects];
+        if (len != UINT8_MAX) {
+            return len;
+        }
+    }
+#endif
+
+    return strlen(object->name);
+}
+
 int thingset_get_path(struct thingset_context *ts, char *buf, size_t size,
                       const struct thingset_data_object *obj)
 {
+#ifdef CONFIG_THINGSET_PATH_INDEX
+    if (index_available(ts) && obj >= ts->data_objects && obj < ts->data_objects + ts->num_objects
+        && ts->path_lengths[obj - ts->data_objects] != PATH_INDEX_NONE)
+    {
+        return path_index_write(ts, obj - ts->data_objects, buf, size);
+    }
+#endif
+
     int pos = 0;
     if (obj->parent_id != 0) {
         struct thingset_data_object *parent_obj = thingset_get_object_by_id(ts, obj->parent_id);
@@ -766,32 +2903,59 @@ int thingset_get_path(struct thingset_context *ts, char *buf, size_t size,
     }
 }
 
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+size_t thingset_get_path_length(struct thingset_context *ts,
+                                const struct thingset_data_object *obj)
+{
+#ifdef CONFIG_THINGSET_PATH_INDEX
+    if (index_available(ts) && obj >= ts->data_objects && obj < ts->data_objects + ts->num_objects
+        && ts->path_lengths[obj - ts->data_objects] != PATH_INDEX_NONE)
+    {
+        return ts->path_lengths[obj - ts->data_objects];
+    }
+#endif
+
+    size_t len = thingset_get_name_length(ts, obj);
+
+    if (obj->parent_id != 0) {
+        struct thingset_data_object *parent_obj = thingset_get_object_by_id(ts, obj->parent_id);
+        if (parent_obj != NULL) {
+            /* same recursion as in thingset_get_path */
+            len += thingset_get_path_length(ts, parent_obj) + 1;
+        }
+    }
+
+    return len;
+}
+#endif
+
 static inline char *type_to_type_name(const enum thingset_type type)
 {
     return type_name_lookup[type];
 }
 
-static int get_function_arg_types(struct thingset_context *ts, uint16_t parent_id, char *buf,
-                                  size_t size)
+static int get_function_arg_types(struct thingset_context *ts,
+                                  const struct thingset_data_object *fn, char *buf, size_t size)
 {
     int total_len = 0;
-    for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].parent_id == parent_id) {
-            int len = 0;
-            if (total_len > 0) {
-                if (size < 2) {
-                    return -THINGSET_ERR_RESPONSE_TOO_LARGE;
-                }
-                len += snprintf(buf, size, ",");
-            }
-            char *elementType = type_to_type_name(ts->data_objects[i].type);
-            len += snprintf(buf + len, size - len, "%s", elementType);
-            buf += len;
-            size -= len;
-            total_len += len;
-            if (total_len > size) {
+    unsigned int pos;
+    for (struct thingset_data_object *arg = thingset_get_first_child(ts, fn, &pos); arg != NULL;
+         arg = thingset_get_next_child(ts, fn, &pos))
+    {
+        int len = 0;
+        if (total_len > 0) {
+            if (size < 2) {
                 return -THINGSET_ERR_RESPONSE_TOO_LARGE;
             }
+            len += snprintf(buf, size, ",");
+        }
+        char *elementType = type_to_type_name(arg->type);
+        len += snprintf(buf + len, size - len, "%s", elementType);
+        buf += len;
+        size -= len;
+        total_len += len;
+        if (total_len > size) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
         }
     }
     return total_len;
@@ -811,7 +2975,7 @@ int thingset_get_type_name(struct thingset_context *ts, const struct thingset_da
         case THINGSET_TYPE_FN_VOID:
         case THINGSET_TYPE_FN_I32:
             snprintf(buf, size, "(");
-            int len = 1 + get_function_arg_types(ts, obj->id, buf + 1, size - 1);
+            int len = 1 + get_function_arg_types(ts, obj, buf + 1, size - 1);
             if (len < 0) {
                 return -THINGSET_ERR_RESPONSE_TOO_LARGE;
             }
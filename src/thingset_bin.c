@@ -27,14 +27,15 @@ static void bin_decoder_init(struct thingset_context *ts, const uint8_t *payload
     ts->decoder->constant_state->enforce_canonical = false;
 }
 
-static int bin_serialize_map_start(struct thingset_context *ts)
+static int bin_serialize_map_start(struct thingset_context *ts, size_t num_elements)
 {
-    return zcbor_map_start_encode(ts->encoder, UINT8_MAX) ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    return zcbor_map_start_encode(ts->encoder, num_elements) ? 0
+                                                             : -THINGSET_ERR_RESPONSE_TOO_LARGE;
 }
 
-static int bin_serialize_map_end(struct thingset_context *ts)
+static int bin_serialize_map_end(struct thingset_context *ts, size_t num_elements)
 {
-    return zcbor_map_end_encode(ts->encoder, UINT8_MAX) ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    return zcbor_map_end_encode(ts->encoder, num_elements) ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
 }
 
 static int bin_serialize_list_start(struct thingset_context *ts)
@@ -153,6 +154,135 @@ static int bin_serialize_simple_value(zcbor_state_t *encoder, union thingset_dat
     }
 }
 
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+/* CBOR additional information for arguments stored in the following 4 or 8 bytes */
+#define CBOR_ARG_4_BYTES 26
+#define CBOR_ARG_8_BYTES 27
+
+static bool bin_put_fixed_width(zcbor_state_t *encoder, uint8_t major_type, uint64_t arg,
+                                size_t size)
+{
+    if (encoder->payload_end - encoder->payload < 1 + size) {
+        return false;
+    }
+
+    encoder->payload_mut[0] = (major_type << 5) | (size == 4 ? CBOR_ARG_4_BYTES : CBOR_ARG_8_BYTES);
+    for (size_t i = size; i > 0; i--) {
+        encoder->payload_mut[i] = arg & 0xFF;
+        arg >>= 8;
+    }
+    encoder->payload_mut += 1 + size;
+    encoder->elem_count++;
+
+    return true;
+}
+
+static bool bin_put_fixed_width_int(zcbor_state_t *encoder, int64_t value, size_t size)
+{
+    if (value < 0) {
+        return bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_NINT, -1 - value, size);
+    }
+    else {
+        return bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_PINT, value, size);
+    }
+}
+
+static bool bin_fixed_width_type(int type)
+{
+    switch (type) {
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+        case THINGSET_TYPE_I64:
+#endif
+        case THINGSET_TYPE_U32:
+        case THINGSET_TYPE_I32:
+        case THINGSET_TYPE_U16:
+        case THINGSET_TYPE_I16:
+        case THINGSET_TYPE_U8:
+        case THINGSET_TYPE_I8:
+        case THINGSET_TYPE_F32:
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC:
+#endif
+        case THINGSET_TYPE_BOOL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Serialize numbers and booleans with their maximum-width encoding, so that the length only
+ * depends on the type.
+ *
+ * @returns 0 or negative ThingSet reponse code in case of error
+ */
+static int bin_serialize_fixed_width_value(zcbor_state_t *encoder,
+                                           union thingset_data_pointer data, int type, int detail)
+{
+    bool success;
+    uint32_t f32_bits;
+
+    switch (type) {
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+            success = bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_PINT, *data.u64, 8);
+            break;
+        case THINGSET_TYPE_I64:
+            success = bin_put_fixed_width_int(encoder, *data.i64, 8);
+            break;
+#endif
+        case THINGSET_TYPE_U32:
+            success = bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_PINT, *data.u32, 4);
+            break;
+        case THINGSET_TYPE_I32:
+            success = bin_put_fixed_width_int(encoder, *data.i32, 4);
+            break;
+        case THINGSET_TYPE_U16:
+            success = bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_PINT, *data.u16, 4);
+            break;
+        case THINGSET_TYPE_I16:
+            success = bin_put_fixed_width_int(encoder, *data.i16, 4);
+            break;
+        case THINGSET_TYPE_U8:
+            success = bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_PINT, *data.u8, 4);
+            break;
+        case THINGSET_TYPE_I8:
+            success = bin_put_fixed_width_int(encoder, *data.i8, 4);
+            break;
+        case THINGSET_TYPE_F32:
+            /* always encoded as float, even with 0 decimals */
+            memcpy(&f32_bits, data.f32, sizeof(f32_bits));
+            success = bin_put_fixed_width(encoder, ZCBOR_MAJOR_TYPE_SIMPLE, f32_bits, 4);
+            break;
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC:
+            /* the exponent is constant for each data object */
+            success = zcbor_tag_put(encoder, ZCBOR_TAG_DECFRAC_ARR);
+            success = success && zcbor_list_start_encode(encoder, 2);
+            success = success && zcbor_int32_put(encoder, -detail);
+            success = success && bin_put_fixed_width_int(encoder, *data.decfrac, 4);
+            success = success && zcbor_list_end_encode(encoder, 2);
+            break;
+#endif
+        case THINGSET_TYPE_BOOL:
+            success = zcbor_bool_put(encoder, *data.b);
+            break;
+        default:
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    if (success) {
+        return 0;
+    }
+    else {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+}
+
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
+
 static int bin_serialize_path(struct thingset_context *ts,
                               const struct thingset_data_object *object)
 {
@@ -172,11 +302,24 @@ static int bin_serialize_path(struct thingset_context *ts,
                : -THINGSET_ERR_RESPONSE_TOO_LARGE;
 }
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+static int bin_serialize_path_key(struct thingset_context *ts,
+                                  const struct thingset_data_object *object)
+{
+    if (ts->endpoint.use_ids) {
+        return zcbor_uint32_put(ts->encoder, object->id) ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+    else {
+        return bin_serialize_path(ts, object);
+    }
+}
+#endif
+
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
 static int bin_serialize_metadata(struct thingset_context *ts,
                                   const struct thingset_data_object *object)
 {
-    int err = bin_serialize_map_start(ts);
+    int err = bin_serialize_map_start(ts, 2);
     if (err) {
         return err;
     }
@@ -204,7 +347,7 @@ static int bin_serialize_metadata(struct thingset_context *ts,
         return -THINGSET_ERR_RESPONSE_TOO_LARGE;
     }
 
-    if ((err = bin_serialize_map_end(ts))) {
+    if ((err = bin_serialize_map_end(ts, 2))) {
         return err;
     }
 
@@ -218,6 +361,13 @@ static int bin_serialize_value(struct thingset_context *ts,
     bool success = false;
     int err;
 
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    if (ts->bin_fixed_width && bin_fixed_width_type(object->type)) {
+        return bin_serialize_fixed_width_value(ts->encoder, object->data, object->type,
+                                               object->detail);
+    }
+#endif
+
     err = bin_serialize_simple_value(ts->encoder, object->data, object->type, object->detail);
     if (err != -THINGSET_ERR_UNSUPPORTED_FORMAT) {
         return err;
@@ -229,42 +379,53 @@ static int bin_serialize_value(struct thingset_context *ts,
     }
     else if (object->type == THINGSET_TYPE_RECORDS) {
         if (IS_ENABLED(CONFIG_THINGSET_REPORT_RECORD_SERIALIZATION)
-            && ts->rsp[0] == THINGSET_BIN_REPORT)
+            && thingset_serializing_report(ts, THINGSET_BIN_REPORT))
         {
-            /* serialise all records */
-            success = zcbor_list_start_encode(ts->encoder, UINT8_MAX);
-            for (unsigned int i = 0; i < object->data.records->num_records; i++) {
-                err = thingset_common_serialize_record(ts, object, i);
+            /* serialise all records (nested containers with exact size, so that no space for
+             * a larger header is reserved) */
+            size_t num_records = object->data.records->num_records;
+            size_t num_fields = thingset_count_record_fields(ts, object);
+            success = zcbor_list_start_encode(ts->encoder, num_records);
+            for (unsigned int i = 0; i < num_records && success; i++) {
+                success = thingset_common_serialize_record(ts, object, i, num_fields) == 0;
             }
-            success = success && zcbor_list_end_encode(ts->encoder, UINT8_MAX);
+            success = success && zcbor_list_end_encode(ts->encoder, num_records);
         }
         else {
             success = zcbor_uint32_put(ts->encoder, object->data.records->num_records);
         }
     }
     else if (object->type == THINGSET_TYPE_FN_VOID || object->type == THINGSET_TYPE_FN_I32) {
-        success = zcbor_list_start_encode(ts->encoder, UINT8_MAX);
-        for (unsigned int i = 0; i < ts->num_objects; i++) {
-            if (ts->data_objects[i].parent_id == object->id) {
-                zcbor_tstr_encode_ptr(ts->encoder, ts->data_objects[i].name,
-                                      strlen(ts->data_objects[i].name));
-            }
+        size_t num_params = 0;
+        unsigned int pos;
+        for (struct thingset_data_object *param = thingset_get_first_child(ts, object, &pos);
+             param != NULL; param = thingset_get_next_child(ts, object, &pos))
+        {
+            num_params++;
         }
-        success = success && zcbor_list_end_encode(ts->encoder, UINT8_MAX);
+        success = zcbor_list_start_encode(ts->encoder, num_params);
+        for (struct thingset_data_object *param = thingset_get_first_child(ts, object, &pos);
+             param != NULL; param = thingset_get_next_child(ts, object, &pos))
+        {
+            success = success
+                      && zcbor_tstr_encode_ptr(ts->encoder, param->name, strlen(param->name));
+        }
+        success = success && zcbor_list_end_encode(ts->encoder, num_params);
     }
     else if (object->type == THINGSET_TYPE_SUBSET) {
-        success = zcbor_list_start_encode(ts->encoder, UINT8_MAX);
-        for (unsigned int i = 0; i < ts->num_objects; i++) {
-            if (ts->data_objects[i].subsets & object->data.subset) {
-                if (ts->endpoint.use_ids) {
-                    success = success && zcbor_uint32_put(ts->encoder, ts->data_objects[i].id);
-                }
-                else {
-                    success = success && (bin_serialize_path(ts, &ts->data_objects[i]) == 0);
-                }
+        size_t num_members = thingset_count_subset_members(ts, object->data.subset);
+        success = zcbor_list_start_encode(ts->encoder, num_members);
+        for (unsigned int i = thingset_next_subset_member(ts, object->data.subset, 0);
+             i < ts->num_objects; i = thingset_next_subset_member(ts, object->data.subset, i + 1))
+        {
+            if (ts->endpoint.use_ids) {
+                success = success && zcbor_uint32_put(ts->encoder, ts->data_objects[i].id);
+            }
+            else {
+                success = success && (bin_serialize_path(ts, &ts->data_objects[i]) == 0);
             }
         }
-        success = success && zcbor_list_end_encode(ts->encoder, UINT8_MAX);
+        success = success && zcbor_list_end_encode(ts->encoder, num_members);
     }
     else if (object->type == THINGSET_TYPE_ARRAY) {
         struct thingset_array *array = object->data.array;
@@ -298,8 +459,74 @@ static int bin_serialize_value(struct thingset_context *ts,
     }
 }
 
+#ifdef CONFIG_THINGSET_BINARY_KEY_CACHE
+
+/**
+ * Copy the pre-encoded key directly into the response buffer.
+ *
+ * @returns 0 for success, negative ThingSet response code in case of error or 1 if the key is not
+ *          cached
+ */
+static int bin_serialize_cached_key(struct thingset_context *ts,
+                                    const struct thingset_data_object *object)
+{
+    zcbor_state_t *encoder = ts->encoder;
+    size_t remaining = encoder->payload_end - encoder->payload;
+
+    if (!ts->key_cache_valid || object < ts->data_objects
+        || object >= ts->data_objects + ts->num_objects)
+    {
+        return 1;
+    }
+
+    unsigned int index = object - ts->data_objects;
+
+    if (ts->endpoint.use_ids) {
+        const uint8_t *key = ts->bin_key_ids[index];
+        size_t len = key[0] < 0x18 ? 1 : (key[0] == 0x18 ? 2 : 3);
+        if (len > remaining) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        memcpy(encoder->payload_mut, key, len);
+        encoder->payload_mut += len;
+    }
+    else {
+        size_t name_len = ts->key_name_lengths[index];
+        if (name_len == UINT8_MAX) {
+            return 1;
+        }
+        /* text string (major type 3) header */
+        size_t header_len = name_len < 24 ? 1 : 2;
+        if (header_len + name_len > remaining) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        if (header_len == 1) {
+            encoder->payload_mut[0] = 0x60 | name_len;
+        }
+        else {
+            encoder->payload_mut[0] = 0x78;
+            encoder->payload_mut[1] = name_len;
+        }
+        memcpy(encoder->payload_mut + header_len, object->name, name_len);
+        encoder->payload_mut += header_len + name_len;
+    }
+
+    encoder->elem_count++;
+
+    return 0;
+}
+
+#endif /* CONFIG_THINGSET_BINARY_KEY_CACHE */
+
 static int bin_serialize_key(struct thingset_context *ts, const struct thingset_data_object *object)
 {
+#ifdef CONFIG_THINGSET_BINARY_KEY_CACHE
+    int ret = bin_serialize_cached_key(ts, object);
+    if (ret <= 0) {
+        return ret;
+    }
+#endif
+
     if (ts->endpoint.use_ids) {
         if (zcbor_uint32_put(ts->encoder, object->id) == false) {
             return -THINGSET_ERR_RESPONSE_TOO_LARGE;
@@ -328,12 +555,77 @@ static int bin_serialize_key_value(struct thingset_context *ts,
 static void bin_serialize_finish(struct thingset_context *ts)
 {
     ts->rsp_pos = ts->encoder->payload - ts->rsp;
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    if (ts->sink != NULL && ts->sink_flushed > 0) {
+        /* beginning of the message was already flushed */
+        return;
+    }
+#endif
+
     if (ts->rsp_pos == 2 && ts->rsp[1] == 0xF6) {
         /* message with empty payload */
         ts->rsp[ts->rsp_pos++] = 0xF6;
     }
 }
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+static size_t bin_serialize_length(struct thingset_context *ts)
+{
+    return ts->encoder->payload - ts->rsp;
+}
+
+static void bin_serialize_truncate(struct thingset_context *ts, size_t len)
+{
+    ts->encoder->payload_mut = ts->rsp + len;
+}
+
+/**
+ * Prepare the first piece of a continued response.
+ *
+ * The header of the map or list was serialized with a placeholder for the number of elements,
+ * which is normally updated when closing the map or list. It is replaced with the number of
+ * elements of the entire response, as the map or list is not closed in the last piece.
+ */
+static void bin_response_continued(struct thingset_context *ts)
+{
+    /* header follows the status code and the null in place of the endpoint */
+    uint8_t *header = ts->rsp + 2;
+    const size_t placeholder_len = 2;
+    bool success;
+
+    zcbor_new_encode_state(ts->encoder, ZCBOR_ARRAY_SIZE(ts->encoder), header, placeholder_len,
+                           1);
+    if (ts->cont_type == THINGSET_CONT_GROUP || ts->cont_type == THINGSET_CONT_RECORD) {
+        success = zcbor_map_start_encode(ts->encoder, ts->cont_num);
+    }
+    else {
+        success = zcbor_list_start_encode(ts->encoder, ts->cont_num);
+    }
+
+    if (!success) {
+        /* same limit for the number of elements as for a response in a single piece */
+        ts->cont_type = THINGSET_CONT_NONE;
+        bin_serialize_response(ts, THINGSET_ERR_RESPONSE_TOO_LARGE, NULL);
+        bin_serialize_finish(ts);
+        return;
+    }
+
+    size_t header_len = ts->encoder->payload - header;
+    if (header_len < placeholder_len) {
+        memmove(header + header_len, header + placeholder_len,
+                ts->rsp_pos - (header - ts->rsp) - placeholder_len);
+        ts->rsp_pos -= placeholder_len - header_len;
+    }
+
+    /* position of the next requested element (FETCH only) */
+    ts->cont_msg_pos = ts->decoder->payload - ts->msg;
+    ts->cont_msg_remaining = ts->decoder->elem_count;
+}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 /**
  * Parse endpoint and fill response buffer with response in case of error.
  *
@@ -387,39 +679,32 @@ int thingset_bin_export_subsets_progressively(struct thingset_context *ts, uint1
                                               unsigned int *index, size_t *len)
 {
     if (*index == 0) {
-        size_t num_elements = 0;
-        for (int i = 0; i < ts->num_objects; i++) {
-            if (ts->data_objects[i].subsets & subsets) {
-                num_elements++;
-            }
-        }
-        zcbor_map_start_encode(ts->encoder, num_elements);
-    }
-
-    while (*index < ts->num_objects) {
-        if (ts->data_objects[*index].subsets & subsets) {
-            /* update last length in case next serialisation runs out of room */
-            *len = ts->rsp_pos;
-            int ret = bin_serialize_key_value(ts, &ts->data_objects[*index]);
-            if (ret == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
-                if (ts->rsp_pos > 0) {
-                    /* reset pointer to position before we encoded this key-value
-                     * pair and ask for more data
-                     */
-                    ts->encoder->payload_mut = ts->rsp;
-                    ts->rsp_pos = 0;
-                    return 1;
-                }
-                else {
-                    /* this element alone is too large to fit the buffer */
-                    return -THINGSET_ERR_RESPONSE_TOO_LARGE;
-                }
+        zcbor_map_start_encode(ts->encoder, thingset_count_subset_members(ts, subsets));
+    }
+
+    for (*index = thingset_next_subset_member(ts, subsets, *index); *index < ts->num_objects;
+         *index = thingset_next_subset_member(ts, subsets, *index + 1))
+    {
+        /* update last length in case next serialisation runs out of room */
+        *len = ts->rsp_pos;
+        int ret = bin_serialize_key_value(ts, &ts->data_objects[*index]);
+        if (ret == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            if (ts->rsp_pos > 0) {
+                /* reset pointer to position before we encoded this key-value
+                 * pair and ask for more data
+                 */
+                ts->encoder->payload_mut = ts->rsp;
+                ts->rsp_pos = 0;
+                return 1;
             }
-            else if (ret < 0) {
-                return ret;
+            else {
+                /* this element alone is too large to fit the buffer */
+                return -THINGSET_ERR_RESPONSE_TOO_LARGE;
             }
         }
-        (*index)++;
+        else if (ret < 0) {
+            return ret;
+        }
         ts->rsp_pos = ts->encoder->payload - ts->rsp;
         *len = ts->rsp_pos;
     }
@@ -433,16 +718,207 @@ int thingset_bin_export_subsets_progressively(struct thingset_context *ts, uint1
     return 0;
 }
 
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+/**
+ * Flush the data in front of the given position (which did not fit into the staging buffer
+ * anymore) and rebase the encoder to the beginning of the staging buffer.
+ *
+ * @returns 0 for success or negative ThingSet reponse code in case of error
+ */
+static int bin_sink_flush(struct thingset_context *ts, const uint8_t *end)
+{
+    if (end == ts->rsp) {
+        /* the staging buffer is too small for a single data item */
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    int err = thingset_sink_flush(ts, end - ts->rsp, 0);
+    if (err != 0) {
+        return err;
+    }
+
+    zcbor_update_state(ts->encoder, ts->rsp, ts->rsp_size);
+
+    return 0;
+}
+
+static int bin_serialize_subsets_to_sink(struct thingset_context *ts, uint16_t subsets)
+{
+    size_t num_members = thingset_count_subset_members(ts, subsets);
+    uint8_t *start = ts->encoder->payload_mut;
+    int err;
+
+    /* number of members is known, so the map header does not have to be updated at the end */
+    if (!zcbor_map_start_encode(ts->encoder, num_members)) {
+        err = bin_sink_flush(ts, start);
+        if (err != 0) {
+            return err;
+        }
+        if (!zcbor_map_start_encode(ts->encoder, num_members)) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+    }
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        start = ts->encoder->payload_mut;
+        err = bin_serialize_key_value(ts, &ts->data_objects[i]);
+        if (err == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            /* pass the previous members to the sink and serialize this member again */
+            err = bin_sink_flush(ts, start);
+            if (err == 0) {
+                err = bin_serialize_key_value(ts, &ts->data_objects[i]);
+            }
+        }
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif /* CONFIG_THINGSET_STREAMING_SINK */
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+/**
+ * Get the content of a string or byte string value if it is long enough to be referenced in
+ * place by a scatter-gather export.
+ *
+ * @returns Length of the content or 0 if the value has to be serialized into the buffer
+ */
+static size_t bin_iovec_content(const struct thingset_data_object *object, uint8_t *major_type,
+                                const uint8_t **content)
+{
+    size_t len;
+
+    switch (object->type) {
+        case THINGSET_TYPE_STRING:
+            *major_type = ZCBOR_MAJOR_TYPE_TSTR;
+            *content = (const uint8_t *)object->data.str;
+            len = strnlen(object->data.str, object->detail);
+            break;
+#if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
+        case THINGSET_TYPE_BYTES:
+            *major_type = ZCBOR_MAJOR_TYPE_BSTR;
+            *content = object->data.bytes->bytes;
+            len = object->data.bytes->num_bytes;
+            break;
+#endif
+        default:
+            /* the native layout of other types (e.g. arrays) differs from CBOR */
+            return 0;
+    }
+
+    return len >= CONFIG_THINGSET_EXPORT_IOVEC_MIN_LEN ? len : 0;
+}
+
+/**
+ * Serialize only the header of a string or byte string, using the shortest possible encoding
+ * of the length.
+ */
+static bool bin_put_string_header(zcbor_state_t *encoder, uint8_t major_type, size_t len)
+{
+    size_t arg_size;
+    uint8_t info;
+
+    if (len < 24) {
+        arg_size = 0;
+        info = len;
+    }
+    else if (len <= UINT8_MAX) {
+        arg_size = 1;
+        info = 24;
+    }
+    else if (len <= UINT16_MAX) {
+        arg_size = 2;
+        info = 25;
+    }
+    else {
+        arg_size = 4;
+        info = 26;
+    }
+
+    if (encoder->payload_end - encoder->payload < 1 + arg_size) {
+        return false;
+    }
+
+    encoder->payload_mut[0] = (major_type << 5) | info;
+    for (size_t i = arg_size; i > 0; i--) {
+        encoder->payload_mut[i] = len & 0xFF;
+        len >>= 8;
+    }
+    encoder->payload_mut += 1 + arg_size;
+    encoder->elem_count++;
+
+    return true;
+}
+
+static int bin_serialize_subsets_iovec(struct thingset_context *ts, uint16_t subsets)
+{
+    const uint8_t *content;
+    uint8_t major_type;
+    int err;
+
+    /* number of members is known, so the map header does not have to be moved at the end */
+    if (!zcbor_map_start_encode(ts->encoder, thingset_count_subset_members(ts, subsets))) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        const struct thingset_data_object *object = &ts->data_objects[i];
+        size_t len = bin_iovec_content(object, &major_type, &content);
+        if (len == 0) {
+            err = bin_serialize_key_value(ts, object);
+            if (err != 0) {
+                return err;
+            }
+            continue;
+        }
+
+        err = ts->api->serialize_key(ts, object);
+        if (err != 0) {
+            return err;
+        }
+
+        if (!bin_put_string_header(ts->encoder, major_type, len)) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+
+        err = thingset_iovec_append(ts, ts->encoder->payload, content, len);
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif /* CONFIG_THINGSET_EXPORT_IOVEC */
+
 static int bin_serialize_subsets(struct thingset_context *ts, uint16_t subsets)
 {
     bool success;
 
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    if (ts->sink != NULL) {
+        return bin_serialize_subsets_to_sink(ts, subsets);
+    }
+#endif
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    if (ts->iov != NULL) {
+        return bin_serialize_subsets_iovec(ts, subsets);
+    }
+#endif
+
     success = zcbor_map_start_encode(ts->encoder, UINT8_MAX);
 
-    for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].subsets & subsets) {
-            bin_serialize_key_value(ts, &ts->data_objects[i]);
-        }
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0);
+         i < ts->num_objects && success; i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        success = bin_serialize_key_value(ts, &ts->data_objects[i]) == 0;
     }
 
     success = success && zcbor_map_end_encode(ts->encoder, UINT8_MAX);
@@ -459,26 +935,129 @@ static int bin_serialize_report_header(struct thingset_context *ts, const char *
 {
     bool success;
 
-    ts->rsp[0] = THINGSET_BIN_REPORT;
+    ts->rsp[0] = THINGSET_BIN_REPORT;
+
+    if (ts->endpoint.use_ids) {
+        if (ts->endpoint.index == THINGSET_ENDPOINT_INDEX_NONE) {
+            success = zcbor_uint32_put(ts->encoder, ts->endpoint.object->id);
+        }
+        else {
+            success = zcbor_list_start_encode(ts->encoder, 2);
+            success |= zcbor_uint32_put(ts->encoder, ts->endpoint.object->id);
+            success |= zcbor_uint32_put(ts->encoder, ts->endpoint.index);
+            success |= zcbor_list_end_encode(ts->encoder, 2);
+        }
+    }
+    else {
+        success = zcbor_tstr_encode_ptr(ts->encoder, path, strlen(path));
+    }
+
+    return success ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+}
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+static int bin_prepare_report_template(struct thingset_context *ts,
+                                       struct thingset_report_template *tmpl, const char *path)
+{
+    int err;
+
+    if (path != NULL) {
+        err = bin_serialize_report_header(ts, path);
+        if (err != 0) {
+            return err;
+        }
+        tmpl->header_len = ts->encoder->payload - ts->rsp;
+    }
+    else {
+        /* keep the previously serialized header */
+        zcbor_update_state(ts->encoder, ts->rsp + tmpl->header_len,
+                           ts->rsp_size - tmpl->header_len);
+    }
+
+    /* number of members is known, so the map header does not have to be updated at the end */
+    if (!zcbor_map_start_encode(ts->encoder, tmpl->num_members)) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    for (unsigned int i = 0; i < tmpl->num_members; i++) {
+        err = bin_serialize_key(ts, &ts->data_objects[tmpl->members[i]]);
+        if (err != 0) {
+            return err;
+        }
+        tmpl->segment_ends[i] = ts->encoder->payload - ts->rsp;
+    }
+
+    tmpl->segment_ends[tmpl->num_members] = ts->encoder->payload - ts->rsp;
+
+    return 0;
+}
+
+static int bin_serialize_report_template(struct thingset_context *ts,
+                                         const struct thingset_report_template *tmpl)
+{
+    size_t start = 0;
+
+    /* the first segment also contains the message type */
+    zcbor_update_state(ts->encoder, ts->rsp, ts->rsp_size);
+
+    for (unsigned int i = 0; i <= tmpl->num_members; i++) {
+        size_t len = tmpl->segment_ends[i] - start;
+        if (len > ts->encoder->payload_end - ts->encoder->payload) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        memcpy(ts->encoder->payload_mut, tmpl->data + start, len);
+        ts->encoder->payload_mut += len;
+        start = tmpl->segment_ends[i];
+
+        if (i < tmpl->num_members) {
+            int err = bin_serialize_value(ts, &ts->data_objects[tmpl->members[i]]);
+            if (err != 0) {
+                return err;
+            }
+        }
+    }
+
+    return 0;
+}
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+int thingset_bin_patch_report(struct thingset_context *ts,
+                              const struct thingset_report_template *tmpl)
+{
+    size_t pos = tmpl->segment_ends[0];
+
+    /* check all members first, so that the report is not modified in case of an error */
+    for (unsigned int i = 0; i < tmpl->num_members; i++) {
+        if (!bin_fixed_width_type(ts->data_objects[tmpl->members[i]].type)) {
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+        }
+    }
+
+    for (unsigned int i = 0; i < tmpl->num_members; i++) {
+        const struct thingset_data_object *object = &ts->data_objects[tmpl->members[i]];
 
-    if (ts->endpoint.use_ids) {
-        if (ts->endpoint.index == THINGSET_ENDPOINT_INDEX_NONE) {
-            success = zcbor_uint32_put(ts->encoder, ts->endpoint.object->id);
-        }
-        else {
-            success = zcbor_list_start_encode(ts->encoder, UINT8_MAX);
-            success |= zcbor_uint32_put(ts->encoder, ts->endpoint.object->id);
-            success |= zcbor_uint32_put(ts->encoder, ts->endpoint.index);
-            success |= zcbor_list_end_encode(ts->encoder, UINT8_MAX);
+        zcbor_update_state(ts->encoder, ts->rsp + pos, ts->rsp_size - pos);
+        int err = bin_serialize_fixed_width_value(ts->encoder, object->data, object->type,
+                                                  object->detail);
+        if (err != 0) {
+            return err;
         }
-    }
-    else {
-        success = zcbor_tstr_encode_ptr(ts->encoder, path, strlen(path));
+
+        /* skip the key of the next member */
+        pos = ts->encoder->payload - ts->rsp + tmpl->segment_ends[i + 1] - tmpl->segment_ends[i];
     }
 
-    return success ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    ts->rsp_pos = pos;
+
+    return 0;
 }
 
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
+
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
 static void bin_deserialize_payload_reset(struct thingset_context *ts)
 {
     bin_decoder_init(ts, ts->msg_payload, ts->msg_len - (ts->msg_payload - ts->msg));
@@ -687,6 +1266,42 @@ static int bin_deserialize_simple_value(struct thingset_context *ts,
     return success ? 0 : -THINGSET_ERR_UNSUPPORTED_FORMAT;
 }
 
+/*
+ * Find the field with the given ID in a records object, starting the search at the field following
+ * the previous match, as the fields are typically received in the same order as serialized. Only
+ * if the search reaches the end, it restarts with the first field.
+ *
+ * @param next_field Field where the search starts, updated to the field following the match.
+ * @param pos Iteration state after next_field, updated accordingly.
+ */
+static struct thingset_data_object *bin_find_record_field(
+    struct thingset_context *ts, const struct thingset_data_object *records, uint32_t id,
+    struct thingset_data_object **next_field, unsigned int *pos)
+{
+    struct thingset_data_object *start = *next_field;
+    struct thingset_data_object *field;
+
+    for (field = start; field != NULL; field = thingset_get_next_record_field(ts, records, pos)) {
+        if (field->id == id) {
+            *next_field = thingset_get_next_record_field(ts, records, pos);
+            return field;
+        }
+    }
+
+    for (field = thingset_get_first_record_field(ts, records, pos); field != start;
+         field = thingset_get_next_record_field(ts, records, pos))
+    {
+        if (field->id == id) {
+            *next_field = thingset_get_next_record_field(ts, records, pos);
+            return field;
+        }
+    }
+
+    /* not found, so the search stopped at the start again */
+    *next_field = start;
+    return NULL;
+}
+
 static int bin_deserialize_value(struct thingset_context *ts,
                                  const struct thingset_data_object *object, bool check_only)
 {
@@ -733,6 +1348,9 @@ static int bin_deserialize_value(struct thingset_context *ts,
             case THINGSET_TYPE_RECORDS:
                 struct thingset_records *records = object->data.records;
                 uint32_t id;
+                unsigned int pos;
+                struct thingset_data_object *next_field =
+                    thingset_get_first_record_field(ts, object, &pos);
 
                 success = zcbor_list_start_decode(ts->decoder);
                 for (unsigned int i = 0; i < records->num_records; i++) {
@@ -743,7 +1361,9 @@ static int bin_deserialize_value(struct thingset_context *ts,
                     }
 
                     while (zcbor_uint32_decode(ts->decoder, &id) && id < UINT16_MAX) {
-                        struct thingset_data_object *element = thingset_get_object_by_id(ts, id);
+                        /* only the fields of this records object are considered */
+                        struct thingset_data_object *element =
+                            bin_find_record_field(ts, object, id, &next_field, &pos);
                         if (element == NULL) {
                             zcbor_any_skip(ts->decoder, NULL);
                             continue;
@@ -783,6 +1403,266 @@ static int bin_deserialize_finish(struct thingset_context *ts)
     return ts->decoder->payload_end == ts->decoder->payload ? 0 : -THINGSET_ERR_BAD_REQUEST;
 }
 
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+/**
+ * @returns Length of a CBOR header with the given argument (e.g. length or integer value)
+ */
+static inline size_t bin_header_size(uint32_t arg)
+{
+    if (arg < 24) {
+        return 1;
+    }
+    else if (arg <= UINT8_MAX) {
+        return 2;
+    }
+    else if (arg <= UINT16_MAX) {
+        return 3;
+    }
+    else {
+        return 5;
+    }
+}
+
+/**
+ * @returns Maximum length of a simple value or 0 if the type is not a simple value
+ */
+static size_t bin_simple_value_size_max(union thingset_data_pointer data, int type, int detail)
+{
+    switch (type) {
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+        case THINGSET_TYPE_I64:
+            return 9;
+#endif
+        case THINGSET_TYPE_U32:
+        case THINGSET_TYPE_I32:
+        case THINGSET_TYPE_F32:
+            return 5;
+        case THINGSET_TYPE_U16:
+        case THINGSET_TYPE_I16:
+            return 3;
+        case THINGSET_TYPE_U8:
+        case THINGSET_TYPE_I8:
+            return 2;
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC:
+            /* tag and list header followed by the constant exponent and the mantissa */
+            return 1 + 1 + bin_header_size(detail > 0 ? detail - 1 : -detail) + 5;
+#endif
+        case THINGSET_TYPE_BOOL:
+            return 1;
+        case THINGSET_TYPE_STRING: {
+            size_t len = detail > 0 ? detail - 1 : 0;
+            return bin_header_size(len) + len;
+        }
+#if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
+        case THINGSET_TYPE_BYTES:
+            return bin_header_size(data.bytes->max_bytes) + data.bytes->max_bytes;
+#endif
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @returns Length of a simple value with its current value or 0 if the type is not a simple value
+ */
+static size_t bin_simple_value_size(union thingset_data_pointer data, int type, int detail,
+                                    bool fixed_width)
+{
+    /* sufficient for all numbers including decimal fractions with tag and exponent */
+    uint8_t buf[16];
+    zcbor_state_t encoder[3];
+    int err;
+
+    switch (type) {
+        case THINGSET_TYPE_STRING: {
+            /* same as zcbor_tstr_put_term */
+            size_t len = strnlen(data.str, detail);
+            return bin_header_size(len) + len;
+        }
+#if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
+        case THINGSET_TYPE_BYTES:
+            return bin_header_size(data.bytes->num_bytes) + data.bytes->num_bytes;
+#endif
+        default:
+            break;
+    }
+
+    zcbor_new_encode_state(encoder, ZCBOR_ARRAY_SIZE(encoder), buf, sizeof(buf), 1);
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    if (fixed_width) {
+        err = bin_serialize_fixed_width_value(encoder, data, type, detail);
+    }
+    else
+#endif
+    {
+        err = bin_serialize_simple_value(encoder, data, type, detail);
+    }
+
+    return err == 0 ? encoder->payload - buf : 0;
+}
+
+static size_t bin_key_size(struct thingset_context *ts, const struct thingset_data_object *object)
+{
+    if (ts->endpoint.use_ids) {
+        return bin_header_size(object->id);
+    }
+    else {
+        size_t len = thingset_get_name_length(ts, object);
+        return bin_header_size(len) + len;
+    }
+}
+
+static size_t bin_container_size(struct thingset_context *ts, size_t num_elements, bool max)
+{
+    /* maps and lists of unknown size reserve the header for UINT8_MAX elements during
+     * serialization, which is shrunk to the actual number of elements afterwards */
+    size_t len = bin_header_size(num_elements);
+    return max && len < 2 ? 2 : len;
+}
+
+static size_t bin_value_size(struct thingset_context *ts, const struct thingset_data_object *object,
+                             bool report, bool max)
+{
+    size_t len;
+    size_t num = 0;
+    unsigned int pos;
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    if (ts->bin_fixed_width && bin_fixed_width_type(object->type)) {
+        if (!max) {
+            return bin_simple_value_size(object->data, object->type, object->detail, true);
+        }
+        /* see bin_serialize_fixed_width_value */
+        switch (object->type) {
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+            case THINGSET_TYPE_U64:
+            case THINGSET_TYPE_I64:
+                return 1 + 8;
+#endif
+            case THINGSET_TYPE_DECFRAC:
+            case THINGSET_TYPE_BOOL:
+                /* same as without fixed width, as the mantissa has at most 4 bytes anyway */
+                break;
+            default:
+                return 1 + 4;
+        }
+    }
+#endif
+
+    len = max ? bin_simple_value_size_max(object->data, object->type, object->detail)
+              : bin_simple_value_size(object->data, object->type, object->detail, false);
+    if (len > 0) {
+        return len;
+    }
+
+    switch (object->type) {
+        case THINGSET_TYPE_GROUP:
+            return 1;
+        case THINGSET_TYPE_RECORDS: {
+            struct thingset_records *records = object->data.records;
+            if (IS_ENABLED(CONFIG_THINGSET_REPORT_RECORD_SERIALIZATION) && report) {
+                if (max) {
+                    return bin_container_size(ts, records->max_records, max)
+                           + records->max_records
+                                 * thingset_common_record_size(ts, object, 0, report, max);
+                }
+                for (unsigned int i = 0; i < records->num_records; i++) {
+                    len += thingset_common_record_size(ts, object, i, report, max);
+                }
+                return bin_container_size(ts, records->num_records, max) + len;
+            }
+            return bin_header_size(max ? UINT16_MAX : records->num_records);
+        }
+        case THINGSET_TYPE_FN_VOID:
+        case THINGSET_TYPE_FN_I32:
+            for (struct thingset_data_object *param = thingset_get_first_child(ts, object, &pos);
+                 param != NULL; param = thingset_get_next_child(ts, object, &pos))
+            {
+                size_t name_len = thingset_get_name_length(ts, param);
+                len += bin_header_size(name_len) + name_len;
+                num++;
+            }
+            return bin_container_size(ts, num, max) + len;
+        case THINGSET_TYPE_SUBSET:
+            for (unsigned int i = thingset_next_subset_member(ts, object->data.subset, 0);
+                 i < ts->num_objects;
+                 i = thingset_next_subset_member(ts, object->data.subset, i + 1))
+            {
+                if (ts->endpoint.use_ids) {
+                    len += bin_header_size(ts->data_objects[i].id);
+                }
+                else {
+                    /* the path is temporarily stored behind a 2-byte header (see
+                     * bin_serialize_path) */
+                    size_t path_len = thingset_get_path_length(ts, &ts->data_objects[i]);
+                    size_t header_len = bin_header_size(path_len);
+                    len += (max && header_len < 2 ? 2 : header_len) + path_len;
+                }
+                num++;
+            }
+            return bin_container_size(ts, num, max) + len;
+        case THINGSET_TYPE_ARRAY: {
+            struct thingset_array *array = object->data.array;
+            if (max) {
+                return bin_header_size(array->max_elements)
+                       + array->max_elements
+                             * bin_simple_value_size_max(array->elements, array->element_type,
+                                                         array->decimals);
+            }
+            size_t type_size = thingset_type_size(array->element_type);
+            for (int i = 0; i < array->num_elements; i++) {
+                /* using uint8_t pointer for byte-wise pointer arithmetics */
+                union thingset_data_pointer data = { .u8 = array->elements.u8 + i * type_size };
+                len += bin_simple_value_size(data, array->element_type, array->decimals, false);
+            }
+            return bin_header_size(array->num_elements) + len;
+        }
+        default:
+            return 0;
+    }
+}
+
+static size_t bin_subsets_size(struct thingset_context *ts, uint16_t subsets, bool report,
+                               bool max)
+{
+    size_t len = 0;
+    size_t num = 0;
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        len += bin_key_size(ts, &ts->data_objects[i])
+               + bin_value_size(ts, &ts->data_objects[i], report, max);
+        num++;
+    }
+
+    return bin_container_size(ts, num, max) + len;
+}
+
+static size_t bin_report_header_size(struct thingset_context *ts, const char *path, bool max)
+{
+    /* report type followed by the same header as serialized by bin_serialize_report_header */
+    if (ts->endpoint.use_ids) {
+        if (ts->endpoint.index == THINGSET_ENDPOINT_INDEX_NONE) {
+            return 1 + bin_header_size(ts->endpoint.object->id);
+        }
+        else {
+            return 1 + bin_container_size(ts, 2, max) + bin_header_size(ts->endpoint.object->id)
+                   + bin_header_size(ts->endpoint.index);
+        }
+    }
+    else {
+        size_t len = strlen(path);
+        return 1 + bin_header_size(len) + len;
+    }
+}
+
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
 static struct thingset_api bin_api = {
     .serialize_response = bin_serialize_response,
     .serialize_key = bin_serialize_key,
@@ -791,6 +1671,9 @@ static struct thingset_api bin_api = {
     .serialize_path = bin_serialize_path,
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
     .serialize_metadata = bin_serialize_metadata,
+#endif
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    .serialize_path_key = bin_serialize_path_key,
 #endif
     .serialize_map_start = bin_serialize_map_start,
     .serialize_map_end = bin_serialize_map_end,
@@ -798,7 +1681,22 @@ static struct thingset_api bin_api = {
     .serialize_list_end = bin_serialize_list_end,
     .serialize_subsets = bin_serialize_subsets,
     .serialize_report_header = bin_serialize_report_header,
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    .prepare_report_template = bin_prepare_report_template,
+    .serialize_report_template = bin_serialize_report_template,
+#endif
     .serialize_finish = bin_serialize_finish,
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    .serialize_length = bin_serialize_length,
+    .serialize_truncate = bin_serialize_truncate,
+#endif
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+    .key_size = bin_key_size,
+    .value_size = bin_value_size,
+    .container_size = bin_container_size,
+    .subsets_size = bin_subsets_size,
+    .report_header_size = bin_report_header_size,
+#endif
     .deserialize_payload_reset = bin_deserialize_payload_reset,
     .deserialize_string = bin_deserialize_string,
     .deserialize_null = bin_deserialize_null,
@@ -818,6 +1716,10 @@ inline void thingset_bin_setup(struct thingset_context *ts, size_t rsp_buf_offse
 
     zcbor_new_encode_state(ts->encoder, ZCBOR_ARRAY_SIZE(ts->encoder), ts->rsp + rsp_buf_offset,
                            ts->rsp_size - rsp_buf_offset, 1);
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    ts->bin_fixed_width = false;
+#endif
 }
 
 int thingset_bin_import_data_progressively(struct thingset_context *ts, uint8_t auth_flags,
@@ -847,6 +1749,9 @@ int thingset_bin_import_data_progressively(struct thingset_context *ts, uint8_t
             const struct thingset_data_object *object = thingset_get_object_by_id(ts, id);
             if (object != NULL && (object->access & THINGSET_WRITE_MASK & auth_flags) != 0) {
                 if (ts->api->deserialize_value(ts, object, false) == 0) {
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+                    thingset_object_changed(ts, object);
+#endif
                     successfully_parsed_bytes = ts->decoder->payload - ts->msg;
                 }
                 else {
@@ -919,6 +1824,9 @@ int thingset_bin_import_data(struct thingset_context *ts, uint8_t auth_flags,
                 if ((object->access & THINGSET_WRITE_MASK & auth_flags) != 0) {
                     err = ts->api->deserialize_value(ts, object, false);
                     if (err == 0) {
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+                        thingset_object_changed(ts, object);
+#endif
                         continue;
                     }
                 }
@@ -947,6 +1855,188 @@ int thingset_bin_import_report(struct thingset_context *ts, uint8_t auth_flags,
     return thingset_bin_import_data(ts, auth_flags, subset);
 }
 
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+/* map of imported data currently being processed */
+struct bin_source_level
+{
+    /* group of the map or NULL for the top-level map */
+    const struct thingset_data_object *parent;
+    /* number of remaining key-value pairs or UINT32_MAX for indefinite-length maps */
+    uint32_t remaining;
+};
+
+/**
+ * Decode the header of a CBOR map.
+ *
+ * @returns Length of the header, 0 if more data is required or negative ThingSet response code
+ *          in case of error
+ */
+static int bin_source_map_header(const uint8_t *buf, size_t len, uint32_t *count)
+{
+    uint8_t info = buf[0] & 0x1F;
+
+    if ((buf[0] >> 5) != ZCBOR_MAJOR_TYPE_MAP) {
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+    else if (info < 24) {
+        *count = info;
+        return 1;
+    }
+    else if (info == 31) {
+        *count = UINT32_MAX;
+        return 1;
+    }
+    else if (info > 26) {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    size_t arg_size = 1 << (info - 24);
+    if (len < 1 + arg_size) {
+        return 0;
+    }
+
+    *count = 0;
+    for (size_t i = 1; i <= arg_size; i++) {
+        *count = (*count << 8) | buf[i];
+    }
+
+    return 1 + arg_size;
+}
+
+static inline void bin_source_level_next(struct bin_source_level *level)
+{
+    if (level->remaining != UINT32_MAX) {
+        level->remaining--;
+    }
+}
+
+/**
+ * Import the next element (map start or end or key-value pair) from the window buffer of the
+ * source.
+ *
+ * @returns 0 if the element was imported, 1 if more data is required,
+ *          -THINGSET_ERR_DESERIALIZATION_FINISHED after the end of the top-level map or negative
+ *          ThingSet response code in case of error
+ */
+static int bin_import_source_element(struct thingset_context *ts, struct bin_source_level *levels,
+                                     int *depth, size_t *pos, uint8_t auth_flags)
+{
+    const uint8_t *buf = ts->source->buf + *pos;
+    size_t len = ts->source_len - *pos;
+    const struct thingset_data_object *object = NULL;
+    int ret;
+
+    if (*depth >= 0 && levels[*depth].remaining == 0) {
+        return --(*depth) < 0 ? -THINGSET_ERR_DESERIALIZATION_FINISHED : 0;
+    }
+    else if (len == 0) {
+        return 1;
+    }
+    else if (*depth < 0) {
+        ret = bin_source_map_header(buf, len, &levels[0].remaining);
+        if (ret <= 0) {
+            return ret == 0 ? 1 : ret;
+        }
+        levels[0].parent = NULL;
+        *depth = 0;
+        *pos += ret;
+        return 0;
+    }
+
+    struct bin_source_level *level = &levels[*depth];
+    if (level->remaining == UINT32_MAX && buf[0] == 0xFF) {
+        /* break of indefinite-length map */
+        (*pos)++;
+        return --(*depth) < 0 ? -THINGSET_ERR_DESERIALIZATION_FINISHED : 0;
+    }
+
+    /* a key of the wrong type is a malformed request (as in thingset_bin_import_data) and not
+     * solved by requesting more data */
+    if ((buf[0] >> 5) != (ts->endpoint.use_ids ? ZCBOR_MAJOR_TYPE_PINT : ZCBOR_MAJOR_TYPE_TSTR)) {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    bin_decoder_init(ts, buf, len);
+    ts->decoder->elem_count = 2;
+
+    if (ts->endpoint.use_ids) {
+        uint32_t id;
+        if (!zcbor_uint32_decode(ts->decoder, &id)) {
+            return 1;
+        }
+        if (id <= UINT16_MAX) {
+            object = thingset_get_object_by_id(ts, id);
+        }
+    }
+    else {
+        struct zcbor_string name;
+        if (!zcbor_tstr_decode(ts->decoder, &name)) {
+            return 1;
+        }
+        object = thingset_source_lookup(ts, level->parent, (const char *)name.value, name.len);
+    }
+
+    const uint8_t *value = ts->decoder->payload;
+    if (value == buf + len) {
+        return 1;
+    }
+
+    if (object != NULL && object->type == THINGSET_TYPE_GROUP
+        && (value[0] >> 5) == ZCBOR_MAJOR_TYPE_MAP)
+    {
+        if (*depth + 1 >= CONFIG_THINGSET_IMPORT_SOURCE_MAX_DEPTH) {
+            return -THINGSET_ERR_REQUEST_TOO_LARGE;
+        }
+        uint32_t count;
+        ret = bin_source_map_header(value, buf + len - value, &count);
+        if (ret <= 0) {
+            return ret == 0 ? 1 : ret;
+        }
+        bin_source_level_next(level);
+        levels[++(*depth)] = (struct bin_source_level){ object, count };
+        *pos += value + ret - buf;
+        return 0;
+    }
+
+    /* make sure that the entire value is available before writing it to the data object */
+    if (!zcbor_any_skip(ts->decoder, NULL)) {
+        return 1;
+    }
+    const uint8_t *end = ts->decoder->payload;
+
+    if (object != NULL) {
+        bin_decoder_init(ts, value, end - value);
+        thingset_source_import_value(ts, object, auth_flags);
+    }
+
+    bin_source_level_next(level);
+    *pos += end - buf;
+    return 0;
+}
+
+int thingset_bin_import_source(struct thingset_context *ts, uint8_t auth_flags)
+{
+    struct bin_source_level levels[CONFIG_THINGSET_IMPORT_SOURCE_MAX_DEPTH];
+    int depth = -1;
+    size_t pos = 0;
+    int ret;
+
+    while ((ret = bin_import_source_element(ts, levels, &depth, &pos, auth_flags)) >= 0) {
+        if (ret == 1) {
+            ret = thingset_source_refill(ts, pos);
+            if (ret != 0) {
+                return ret;
+            }
+            pos = 0;
+        }
+    }
+
+    return ret == -THINGSET_ERR_DESERIALIZATION_FINISHED ? 0 : ret;
+}
+
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
 int thingset_bin_process(struct thingset_context *ts)
 {
     int ret;
@@ -989,6 +2079,11 @@ int thingset_bin_process(struct thingset_context *ts)
     }
     if (ts->msg[0] != THINGSET_BIN_DESIRE) {
         ts->api->serialize_finish(ts);
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+        if (ts->cont_type != THINGSET_CONT_NONE) {
+            bin_response_continued(ts);
+        }
+#endif
         return ts->rsp_pos;
     }
     else {
@@ -996,3 +2091,39 @@ int thingset_bin_process(struct thingset_context *ts)
         return ret;
     }
 }
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+int thingset_bin_process_continue(struct thingset_context *ts)
+{
+    int err;
+
+    thingset_bin_setup(ts, 0);
+
+    /* the request is parsed again, as the context may have been used otherwise in the meantime */
+    err = bin_parse_endpoint(ts);
+    if (err == 0) {
+        if (ts->cont_type == THINGSET_CONT_VALUES) {
+            bin_decoder_init(ts, ts->msg + ts->cont_msg_pos, ts->msg_len - ts->cont_msg_pos);
+            ts->decoder->elem_count = ts->cont_msg_remaining;
+        }
+
+        err = thingset_common_continue(ts, false);
+    }
+
+    if (err == -THINGSET_ERR_RESPONSE_CONTINUED) {
+        ts->cont_msg_pos = ts->decoder->payload - ts->msg;
+        ts->cont_msg_remaining = ts->decoder->elem_count;
+    }
+    else {
+        ts->cont_type = THINGSET_CONT_NONE;
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    /* bin_serialize_finish is not used, as pieces don't start with a status code */
+    ts->rsp_pos = ts->encoder->payload - ts->rsp;
+
+    return ts->rsp_pos;
+}
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
@@ -16,12 +16,134 @@
 #include <stdlib.h>
 #include <string.h>
 
-int thingset_common_serialize_group(struct thingset_context *ts,
-                                    const struct thingset_data_object *object)
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+/* Store the length of the current piece of a response in front of its first element */
+static inline void common_start_piece(struct thingset_context *ts, bool resumable)
+{
+    if (resumable) {
+        ts->cont_start = ts->api->serialize_length(ts);
+    }
+}
+
+/*
+ * Store the position of the element to be serialized next, so that the response can be split in
+ * front of it if the element does not fit into the response buffer anymore.
+ */
+static inline void common_mark_element(struct thingset_context *ts, bool resumable,
+                                       const struct thingset_data_object *object, unsigned int pos)
+{
+    if (resumable) {
+        ts->cont_object = object;
+        ts->cont_pos = pos;
+        ts->cont_len = ts->api->serialize_length(ts);
+    }
+}
+
+/*
+ * Split the response in front of the marked element if the response buffer is full, unless the
+ * element is the first one of the current piece.
+ */
+static int common_split_response(struct thingset_context *ts, bool resumable, int err)
+{
+    if (resumable && err == -THINGSET_ERR_RESPONSE_TOO_LARGE && ts->cont_len > ts->cont_start) {
+        ts->api->serialize_truncate(ts, ts->cont_len);
+        return -THINGSET_ERR_RESPONSE_CONTINUED;
+    }
+
+    return err;
+}
+
+/* Count the elements of the map or list of the entire response to be continued */
+static size_t common_count_elements(struct thingset_context *ts)
+{
+    const struct thingset_data_object *object = ts->endpoint.object;
+    size_t num = 0;
+    unsigned int pos;
+
+    switch (ts->cont_type) {
+        case THINGSET_CONT_GROUP:
+        case THINGSET_CONT_NAMES:
+            for (struct thingset_data_object *child = thingset_get_first_child(ts, object, &pos);
+                 child != NULL; child = thingset_get_next_child(ts, object, &pos))
+            {
+                if (child->access & THINGSET_READ_MASK) {
+                    num++;
+                }
+            }
+            break;
+        case THINGSET_CONT_RECORD:
+            for (struct thingset_data_object *item =
+                     thingset_get_first_record_field(ts, object, &pos);
+                 item != NULL; item = thingset_get_next_record_field(ts, object, &pos))
+            {
+                num++;
+            }
+            break;
+        default:
+            /* number of requested values was determined while checking the request */
+            num = ts->cont_num;
+            break;
+    }
+
+    return num;
+}
+
+static void common_response_continued(struct thingset_context *ts, uint8_t type)
+{
+    ts->cont_type = type;
+    ts->cont_num = common_count_elements(ts);
+}
+
+#else
+
+static inline void common_start_piece(struct thingset_context *ts, bool resumable)
+{}
+
+static inline void common_mark_element(struct thingset_context *ts, bool resumable,
+                                       const struct thingset_data_object *object, unsigned int pos)
+{}
+
+static inline int common_split_response(struct thingset_context *ts, bool resumable, int err)
+{
+    return err;
+}
+
+static inline void common_response_continued(struct thingset_context *ts, uint8_t type)
+{}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
+/*
+ * Serialize the readable children of a group, starting with the given child and continuing with
+ * the iteration position behind it.
+ */
+static int common_serialize_children(struct thingset_context *ts,
+                                     const struct thingset_data_object *object,
+                                     const struct thingset_data_object *child, unsigned int pos,
+                                     thingset_common_record_element_action action, bool resumable)
 {
     int err;
 
-    err = ts->api->serialize_map_start(ts);
+    for (; child != NULL; child = thingset_get_next_child(ts, object, &pos)) {
+        if (child->access & THINGSET_READ_MASK) {
+            common_mark_element(ts, resumable, child, pos);
+            err = action(ts, child);
+            if (err != 0) {
+                return common_split_response(ts, resumable, err);
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int common_serialize_group(struct thingset_context *ts,
+                                  const struct thingset_data_object *object, bool resumable)
+{
+    int err;
+
+    err = ts->api->serialize_map_start(ts, THINGSET_NUM_ELEMENTS_UNKNOWN);
     if (err != 0) {
         return err;
     }
@@ -30,22 +152,31 @@ int thingset_common_serialize_group(struct thingset_context *ts,
         object->data.group_callback(THINGSET_CALLBACK_PRE_READ);
     }
 
-    for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].parent_id == object->id
-            && (ts->data_objects[i].access & THINGSET_READ_MASK))
-        {
-            err = ts->api->serialize_key_value(ts, &ts->data_objects[i]);
-            if (err != 0) {
-                return err;
-            }
-        }
+    unsigned int pos;
+    struct thingset_data_object *child = thingset_get_first_child(ts, object, &pos);
+    common_start_piece(ts, resumable);
+    err = common_serialize_children(ts, object, child, pos, ts->api->serialize_key_value,
+                                    resumable);
+    if (err != 0 && err != -THINGSET_ERR_RESPONSE_CONTINUED) {
+        return err;
     }
 
     if (object->data.group_callback != NULL) {
         object->data.group_callback(THINGSET_CALLBACK_POST_READ);
     }
 
-    return ts->api->serialize_map_end(ts);
+    if (err == 0) {
+        err = common_split_response(ts, resumable,
+                                    ts->api->serialize_map_end(ts, THINGSET_NUM_ELEMENTS_UNKNOWN));
+    }
+
+    return err;
+}
+
+int thingset_common_serialize_group(struct thingset_context *ts,
+                                    const struct thingset_data_object *object)
+{
+    return common_serialize_group(ts, object, false);
 }
 
 int thingset_common_prepare_record_element(struct thingset_context *ts,
@@ -104,61 +235,197 @@ int thingset_common_prepare_record_element(struct thingset_context *ts,
     return err;
 }
 
-int thingset_common_serialize_record(struct thingset_context *ts,
-                                     const struct thingset_data_object *object, int record_index)
+/*
+ * Serialize the fields of a record, starting with the given field and continuing with the
+ * iteration position behind it.
+ */
+static int common_serialize_record_fields(struct thingset_context *ts,
+                                          const struct thingset_data_object *object,
+                                          int record_index, const struct thingset_data_object *item,
+                                          unsigned int pos, bool resumable)
 {
     struct thingset_records *records = object->data.records;
     size_t record_offset;
     int err;
 
+    if (object->detail == THINGSET_DETAIL_DYN_RECORDS) {
+        record_offset = 0;
+    }
+    else {
+        record_offset = record_index * records->record_size;
+    }
+
+    for (; item != NULL; item = thingset_get_next_record_field(ts, object, &pos)) {
+        /* create new object with data pointer including offset */
+        uint8_t *record_ptr = (uint8_t *)records->records + record_offset;
+        common_mark_element(ts, resumable, item, pos);
+        err = thingset_common_prepare_record_element(ts, item, record_ptr,
+                                                     ts->api->serialize_key_value);
+
+        if (err != 0) {
+            return common_split_response(ts, resumable, err);
+        }
+    }
+
+    return 0;
+}
+
+static int common_serialize_record(struct thingset_context *ts,
+                                   const struct thingset_data_object *object, int record_index,
+                                   size_t num_fields, bool resumable)
+{
+    struct thingset_records *records = object->data.records;
+    int err;
+
     if (record_index >= records->num_records) {
         return -THINGSET_ERR_NOT_FOUND;
     }
 
-    err = ts->api->serialize_map_start(ts);
+    err = ts->api->serialize_map_start(ts, num_fields);
     if (err != 0) {
         return err;
     }
 
-    if (object->detail == THINGSET_DETAIL_DYN_RECORDS) {
-        record_offset = 0;
+    if (records->callback != NULL) {
+        records->callback(THINGSET_CALLBACK_PRE_READ, record_index);
     }
-    else {
-        record_offset = record_index * records->record_size;
+
+    unsigned int pos;
+    struct thingset_data_object *item = thingset_get_first_record_field(ts, object, &pos);
+    common_start_piece(ts, resumable);
+    err = common_serialize_record_fields(ts, object, record_index, item, pos, resumable);
+    if (err != 0 && err != -THINGSET_ERR_RESPONSE_CONTINUED) {
+        return err;
     }
 
     if (records->callback != NULL) {
-        records->callback(THINGSET_CALLBACK_PRE_READ, record_index);
+        records->callback(THINGSET_CALLBACK_POST_READ, record_index);
     }
 
-    const struct thingset_data_object *item = thingset_get_object_by_id(ts, object->id) + 1;
-    while (item < &ts->data_objects[ts->num_objects]) {
-        if (item->parent_id != object->id) {
-            item++;
-            continue;
+    if (err == 0) {
+        err = common_split_response(ts, resumable, ts->api->serialize_map_end(ts, num_fields));
+    }
+
+    return err;
+}
+
+int thingset_common_serialize_record(struct thingset_context *ts,
+                                     const struct thingset_data_object *object, int record_index,
+                                     size_t num_fields)
+{
+    return common_serialize_record(ts, object, record_index, num_fields, false);
+}
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+size_t thingset_common_group_size(struct thingset_context *ts,
+                                  const struct thingset_data_object *object, bool report, bool max)
+{
+    size_t len = 0;
+    size_t num = 0;
+    unsigned int pos;
+
+    if (!max && object->data.group_callback != NULL) {
+        object->data.group_callback(THINGSET_CALLBACK_PRE_READ);
+    }
+
+    for (struct thingset_data_object *child = thingset_get_first_child(ts, object, &pos);
+         child != NULL; child = thingset_get_next_child(ts, object, &pos))
+    {
+        if (child->access & THINGSET_READ_MASK) {
+            len += ts->api->key_size(ts, child) + ts->api->value_size(ts, child, report, max);
+            num++;
         }
+    }
 
-        /* create new object with data pointer including offset */
-        uint8_t *record_ptr = (uint8_t *)records->records + record_offset;
-        err = thingset_common_prepare_record_element(ts, item, record_ptr,
-                                                     ts->api->serialize_key_value);
+    if (!max && object->data.group_callback != NULL) {
+        object->data.group_callback(THINGSET_CALLBACK_POST_READ);
+    }
 
-        if (err != 0) {
-            return err;
+    return ts->api->container_size(ts, num, max) + len;
+}
+
+size_t thingset_common_record_size(struct thingset_context *ts,
+                                   const struct thingset_data_object *object, int record_index,
+                                   bool report, bool max)
+{
+    struct thingset_records *records = object->data.records;
+    size_t record_offset = 0;
+    size_t len = 0;
+    size_t num = 0;
+    unsigned int pos;
+
+    /* the maximum size of byte strings and nested records is stored in the records, so the first
+     * record is used for the maximum length */
+    if (!max) {
+        if (records->callback != NULL) {
+            records->callback(THINGSET_CALLBACK_PRE_READ, record_index);
+        }
+        /* same offset calculation as in common_serialize_record_fields */
+        if (object->detail != THINGSET_DETAIL_DYN_RECORDS) {
+            record_offset = record_index * records->record_size;
         }
+    }
+
+    uint8_t *record_ptr = (uint8_t *)records->records + record_offset;
+
+    for (struct thingset_data_object *item = thingset_get_first_record_field(ts, object, &pos);
+         item != NULL; item = thingset_get_next_record_field(ts, object, &pos))
+    {
+        len += ts->api->key_size(ts, item);
 
-        item++;
+        if (item->type == THINGSET_TYPE_RECORDS) {
+            struct thingset_records *rec = item->data.records;
+            struct thingset_records rec_offset = {
+                record_ptr + (size_t)rec->records,
+                rec->record_size,
+                rec->max_records,
+                rec->num_records,
+                rec->callback,
+            };
+            struct thingset_data_object record_item_offset = {
+                item->parent_id, item->id,     item->name, { .records = &rec_offset },
+                item->type,      item->detail,
+            };
+            len += ts->api->value_size(ts, &record_item_offset, report, max);
+        }
+        else if (item->type == THINGSET_TYPE_ARRAY) {
+            struct thingset_array *arr = item->data.array;
+            struct thingset_array arr_offset = {
+                { .u8 = record_ptr + arr->elements.offset },
+                arr->element_type,
+                arr->decimals,
+                arr->max_elements,
+                arr->num_elements,
+            };
+            struct thingset_data_object array_item_offset = {
+                item->parent_id,          item->id,   item->name,
+                { .array = &arr_offset }, item->type, item->detail,
+            };
+            len += ts->api->value_size(ts, &array_item_offset, report, max);
+        }
+        else {
+            struct thingset_data_object default_item_offset = {
+                item->parent_id, item->id,     item->name, { .u8 = record_ptr + item->data.offset },
+                item->type,      item->detail,
+            };
+            len += ts->api->value_size(ts, &default_item_offset, report, max);
+        }
+        num++;
     }
 
-    if (records->callback != NULL) {
+    if (!max && records->callback != NULL) {
         records->callback(THINGSET_CALLBACK_POST_READ, record_index);
     }
 
-    return ts->api->serialize_map_end(ts);
+    return ts->api->container_size(ts, num, max) + len;
 }
 
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
 int thingset_common_get(struct thingset_context *ts)
 {
+    bool resumable = IS_ENABLED(CONFIG_THINGSET_RESPONSE_CONTINUATION);
     struct thingset_data_object *parent;
     int err;
 
@@ -166,7 +433,11 @@ int thingset_common_get(struct thingset_context *ts)
 
     switch (ts->endpoint.object->type) {
         case THINGSET_TYPE_GROUP:
-            err = thingset_common_serialize_group(ts, ts->endpoint.object);
+            err = common_serialize_group(ts, ts->endpoint.object, resumable);
+            if (err == -THINGSET_ERR_RESPONSE_CONTINUED) {
+                common_response_continued(ts, THINGSET_CONT_GROUP);
+                err = 0;
+            }
             break;
         case THINGSET_TYPE_FN_VOID:
         case THINGSET_TYPE_FN_I32:
@@ -175,7 +446,12 @@ int thingset_common_get(struct thingset_context *ts)
             break;
         case THINGSET_TYPE_RECORDS:
             if (ts->endpoint.index != THINGSET_ENDPOINT_INDEX_NONE) {
-                err = thingset_common_serialize_record(ts, ts->endpoint.object, ts->endpoint.index);
+                err = common_serialize_record(ts, ts->endpoint.object, ts->endpoint.index,
+                                              THINGSET_NUM_ELEMENTS_UNKNOWN, resumable);
+                if (err == -THINGSET_ERR_RESPONSE_CONTINUED) {
+                    common_response_continued(ts, THINGSET_CONT_RECORD);
+                    err = 0;
+                }
                 break;
             }
             err = ts->api->serialize_value(ts, ts->endpoint.object);
@@ -203,8 +479,206 @@ int thingset_common_get(struct thingset_context *ts)
     }
 }
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+/*
+ * Serialize the current data version followed by a map with all readable data objects changed
+ * since the data version provided by the client. The list start was already serialized by the
+ * caller.
+ */
+static int common_fetch_changes(struct thingset_context *ts)
+{
+    uint32_t version;
+    struct thingset_data_object version_object =
+        THINGSET_ITEM_UINT32(0, 0, "Version", &version, THINGSET_ANY_R, 0);
+    int err;
+
+    err = ts->api->deserialize_value(ts, &version_object, false);
+    if (err != 0) {
+        return ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST, "Data version required");
+    }
+
+    uint32_t since = version;
+    version = ts->data_version;
+    err = ts->api->serialize_value(ts, &version_object);
+    if (err != 0) {
+        return ts->api->serialize_response(ts, -err, NULL);
+    }
+
+    err = ts->api->serialize_map_start(ts, THINGSET_NUM_ELEMENTS_UNKNOWN);
+    if (err != 0) {
+        return ts->api->serialize_response(ts, -err, NULL);
+    }
+
+    for (unsigned int i = thingset_next_changed_object(ts, since, 0); i < ts->num_objects;
+         i = thingset_next_changed_object(ts, since, i + 1))
+    {
+        const struct thingset_data_object *object = &ts->data_objects[i];
+
+        /* only data objects carrying a value are reported, items of records are skipped and
+         * records objects are reported with the number of records (same as for a fetch) */
+        if (object->type == THINGSET_TYPE_GROUP || object->type == THINGSET_TYPE_SUBSET
+            || object->type == THINGSET_TYPE_FN_VOID || object->type == THINGSET_TYPE_FN_I32
+            || (object->access & THINGSET_READ_MASK & ts->auth_flags) == 0)
+        {
+            continue;
+        }
+
+        if (object->parent_id != 0) {
+            struct thingset_data_object *parent = thingset_get_object_by_id(ts, object->parent_id);
+            if (parent != NULL && parent->type == THINGSET_TYPE_RECORDS) {
+                continue;
+            }
+        }
+
+        err = ts->api->serialize_path_key(ts, object);
+        if (err == 0) {
+            err = ts->api->serialize_value(ts, object);
+        }
+        if (err != 0) {
+            return ts->api->serialize_response(ts, -err, NULL);
+        }
+    }
+
+    err = ts->api->serialize_map_end(ts, THINGSET_NUM_ELEMENTS_UNKNOWN);
+    if (err == 0) {
+        err = ts->api->serialize_list_end(ts);
+    }
+    if (err != 0) {
+        return ts->api->serialize_response(ts, -err, NULL);
+    }
+
+    return 0;
+}
+#endif /* CONFIG_THINGSET_CHANGES_ENDPOINT */
+
+/*
+ * Check if a requested data object can be fetched.
+ *
+ * @returns 0 if the object can be fetched, otherwise the negative ThingSet response code of the
+ *          error response which was serialized
+ */
+static int common_fetch_check(struct thingset_context *ts,
+                              const struct thingset_data_object *object)
+{
+    if (object->type == THINGSET_TYPE_GROUP && ts->endpoint.object->id != THINGSET_ID_PATHS
+        && ts->endpoint.object->id != THINGSET_ID_METADATA)
+    {
+        ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST, "%s is a group", object->name);
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    if ((object->access & THINGSET_READ_MASK & ts->auth_flags) == 0) {
+        if (object->access & THINGSET_READ_MASK) {
+            ts->api->serialize_response(ts, THINGSET_ERR_UNAUTHORIZED,
+                                        "Authentication required for %s", object->name);
+            return -THINGSET_ERR_UNAUTHORIZED;
+        }
+        else {
+            ts->api->serialize_response(ts, THINGSET_ERR_FORBIDDEN, "Reading %s forbidden",
+                                        object->name);
+            return -THINGSET_ERR_FORBIDDEN;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Serialize the values of the data objects requested in the payload, starting with the given
+ * object (if not NULL).
+ *
+ * @returns 0 for success, -THINGSET_ERR_RESPONSE_CONTINUED if the response was split or negative
+ *          ThingSet response code of the error response which was serialized
+ */
+static int common_fetch_values(struct thingset_context *ts,
+                               const struct thingset_data_object *object, bool resumable)
+{
+    int err = 0;
+
+    /* the given object was already deserialized for a previous piece of the response */
+    while (object != NULL
+           || (err = ts->api->deserialize_child(ts, &object))
+                  != -THINGSET_ERR_DESERIALIZATION_FINISHED)
+    {
+        if (err != 0) {
+            ts->api->serialize_response(ts, -err, NULL);
+            return err;
+        }
+
+        err = common_fetch_check(ts, object);
+        if (err != 0) {
+            return err;
+        }
+
+        common_mark_element(ts, resumable, object, 0);
+
+        if (ts->endpoint.object->id == THINGSET_ID_PATHS) {
+            err = ts->api->serialize_path(ts, object);
+        }
+#ifdef CONFIG_THINGSET_METADATA_ENDPOINT
+        else if (ts->endpoint.object->id == THINGSET_ID_METADATA) {
+            err = ts->api->serialize_metadata(ts, object);
+        }
+#endif
+        else {
+            err = ts->api->serialize_value(ts, object);
+        }
+
+        if (err != 0) {
+            err = common_split_response(ts, resumable, err);
+            if (err != -THINGSET_ERR_RESPONSE_CONTINUED) {
+                ts->api->serialize_response(ts, -err, NULL);
+            }
+            return err;
+        }
+
+        object = NULL;
+    }
+
+    return 0;
+}
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+/*
+ * Check all requested data objects before serializing the first value, as the status code can't
+ * be changed anymore after the first piece of a response was sent.
+ *
+ * @returns 0 for success or negative ThingSet response code of the error response which was
+ *          serialized
+ */
+static int common_fetch_check_all(struct thingset_context *ts)
+{
+    const struct thingset_data_object *object;
+    int err;
+
+    ts->cont_num = 0;
+
+    while ((err = ts->api->deserialize_child(ts, &object))
+           != -THINGSET_ERR_DESERIALIZATION_FINISHED)
+    {
+        if (err != 0) {
+            ts->api->serialize_response(ts, -err, NULL);
+            return err;
+        }
+
+        err = common_fetch_check(ts, object);
+        if (err != 0) {
+            return err;
+        }
+
+        ts->cont_num++;
+    }
+
+    ts->api->deserialize_payload_reset(ts);
+
+    return ts->api->deserialize_list_start(ts);
+}
+#endif
+
 int thingset_common_fetch(struct thingset_context *ts)
 {
+    bool resumable = IS_ENABLED(CONFIG_THINGSET_RESPONSE_CONTINUATION);
+    uint8_t type;
     int err;
 
     /* initialize response with success message */
@@ -212,18 +686,24 @@ int thingset_common_fetch(struct thingset_context *ts)
 
     ts->api->serialize_list_start(ts);
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    if (ts->endpoint.object->id == THINGSET_ID_CHANGES) {
+        return common_fetch_changes(ts);
+    }
+#endif
+
     if (ts->api->deserialize_null(ts) == 0) {
         /* fetch names */
-        for (unsigned int i = 0; i < ts->num_objects; i++) {
-            if ((ts->data_objects[i].access & THINGSET_READ_MASK)
-                && (ts->data_objects[i].parent_id == ts->endpoint.object->id))
-            {
-                err = ts->api->serialize_key(ts, &ts->data_objects[i]);
-                if (err != 0) {
-                    return ts->api->serialize_response(ts, -err, NULL);
-                }
-            }
+        const struct thingset_data_object *parent = ts->endpoint.object;
+        unsigned int pos;
+        struct thingset_data_object *child = thingset_get_first_child(ts, parent, &pos);
+        common_start_piece(ts, resumable);
+        err = common_serialize_children(ts, parent, child, pos, ts->api->serialize_key,
+                                        resumable);
+        if (err != 0 && err != -THINGSET_ERR_RESPONSE_CONTINUED) {
+            return ts->api->serialize_response(ts, -err, NULL);
         }
+        type = THINGSET_CONT_NAMES;
     }
     else if (ts->api->deserialize_list_start(ts) == 0) {
         if (ts->endpoint.object->type != THINGSET_TYPE_GROUP) {
@@ -231,68 +711,109 @@ int thingset_common_fetch(struct thingset_context *ts)
                                                ts->endpoint.object->name);
         }
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+        if (common_fetch_check_all(ts) != 0) {
+            return 0;
+        }
+#endif
+
         /* fetch values */
         if (ts->endpoint.object->data.group_callback != NULL) {
             ts->endpoint.object->data.group_callback(THINGSET_CALLBACK_PRE_READ);
         }
 
-        const struct thingset_data_object *object;
-        while ((err = ts->api->deserialize_child(ts, &object))
-               != -THINGSET_ERR_DESERIALIZATION_FINISHED)
-        {
-            if (err != 0) {
-                return ts->api->serialize_response(ts, -err, NULL);
-            }
-
-            if (object->type == THINGSET_TYPE_GROUP && ts->endpoint.object->id != THINGSET_ID_PATHS
-                && ts->endpoint.object->id != THINGSET_ID_METADATA)
-            {
-                return ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST, "%s is a group",
-                                                   object->name);
-            }
-
-            if ((object->access & THINGSET_READ_MASK & ts->auth_flags) == 0) {
-                if (object->access & THINGSET_READ_MASK) {
-                    return ts->api->serialize_response(ts, THINGSET_ERR_UNAUTHORIZED,
-                                                       "Authentication required for %s",
-                                                       object->name);
-                }
-                else {
-                    return ts->api->serialize_response(ts, THINGSET_ERR_FORBIDDEN,
-                                                       "Reading %s forbidden", object->name);
-                }
-            }
-
-            if (ts->endpoint.object->id == THINGSET_ID_PATHS) {
-                err = ts->api->serialize_path(ts, object);
-            }
-#ifdef CONFIG_THINGSET_METADATA_ENDPOINT
-            else if (ts->endpoint.object->id == THINGSET_ID_METADATA) {
-                err = ts->api->serialize_metadata(ts, object);
-            }
-#endif
-            else {
-                err = ts->api->serialize_value(ts, object);
-            }
-
-            if (err != 0) {
-                return ts->api->serialize_response(ts, -err, NULL);
-            }
+        common_start_piece(ts, resumable);
+        err = common_fetch_values(ts, NULL, resumable);
+        if (err != 0 && err != -THINGSET_ERR_RESPONSE_CONTINUED) {
+            /* error response was already serialized */
+            return 0;
         }
 
         if (ts->endpoint.object->data.group_callback != NULL) {
             ts->endpoint.object->data.group_callback(THINGSET_CALLBACK_POST_READ);
         }
+        type = THINGSET_CONT_VALUES;
     }
     else {
         return ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST, "Invalid payload");
     }
 
-    ts->api->serialize_list_end(ts);
+    if (err == 0) {
+        err = common_split_response(ts, resumable, ts->api->serialize_list_end(ts));
+    }
+
+    if (err == -THINGSET_ERR_RESPONSE_CONTINUED) {
+        common_response_continued(ts, type);
+    }
 
     return 0;
 }
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+int thingset_common_continue(struct thingset_context *ts, bool close)
+{
+    const struct thingset_data_object *object = ts->endpoint.object;
+    struct thingset_records *records;
+    int err;
+
+    common_start_piece(ts, true);
+
+    switch (ts->cont_type) {
+        case THINGSET_CONT_GROUP:
+            if (object->data.group_callback != NULL) {
+                object->data.group_callback(THINGSET_CALLBACK_PRE_READ);
+            }
+            err = common_serialize_children(ts, object, ts->cont_object, ts->cont_pos,
+                                            ts->api->serialize_key_value, true);
+            if (object->data.group_callback != NULL) {
+                object->data.group_callback(THINGSET_CALLBACK_POST_READ);
+            }
+            break;
+        case THINGSET_CONT_RECORD:
+            records = object->data.records;
+            if (ts->endpoint.index >= records->num_records) {
+                return -THINGSET_ERR_NOT_FOUND;
+            }
+            if (records->callback != NULL) {
+                records->callback(THINGSET_CALLBACK_PRE_READ, ts->endpoint.index);
+            }
+            err = common_serialize_record_fields(ts, object, ts->endpoint.index, ts->cont_object,
+                                                 ts->cont_pos, true);
+            if (records->callback != NULL) {
+                records->callback(THINGSET_CALLBACK_POST_READ, ts->endpoint.index);
+            }
+            break;
+        case THINGSET_CONT_NAMES:
+            err = common_serialize_children(ts, object, ts->cont_object, ts->cont_pos,
+                                            ts->api->serialize_key, true);
+            break;
+        case THINGSET_CONT_VALUES:
+            if (object->data.group_callback != NULL) {
+                object->data.group_callback(THINGSET_CALLBACK_PRE_READ);
+            }
+            err = common_fetch_values(ts, ts->cont_object, true);
+            if (object->data.group_callback != NULL) {
+                object->data.group_callback(THINGSET_CALLBACK_POST_READ);
+            }
+            break;
+        default:
+            return -THINGSET_ERR_INTERNAL_SERVER_ERR;
+    }
+
+    if (err == 0 && close) {
+        if (ts->cont_type == THINGSET_CONT_GROUP || ts->cont_type == THINGSET_CONT_RECORD) {
+            err = ts->api->serialize_map_end(ts, THINGSET_NUM_ELEMENTS_UNKNOWN);
+        }
+        else {
+            err = ts->api->serialize_list_end(ts);
+        }
+        err = common_split_response(ts, true, err);
+    }
+
+    return err;
+}
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 int thingset_common_update(struct thingset_context *ts)
 {
     const struct thingset_data_object *object;
@@ -358,6 +879,10 @@ int thingset_common_update(struct thingset_context *ts)
             return ts->api->serialize_response(ts, -err, NULL);
         }
 
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+        thingset_object_changed(ts, object);
+#endif
+
         if (ts->update_subsets & object->subsets) {
             updated = true;
         }
@@ -405,18 +930,20 @@ int thingset_common_exec(struct thingset_context *ts)
                                            ts->endpoint.object->name);
     }
 
-    for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].parent_id == ts->endpoint.object->id) {
-            err = ts->api->deserialize_value(ts, &ts->data_objects[i], false);
-            if (err == -THINGSET_ERR_DESERIALIZATION_FINISHED) {
-                /* more child objects found than parameters were passed */
-                return ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST,
-                                                   "Not enough parameters");
-            }
-            else if (err != 0) {
-                /* deserializing the value was not successful */
-                return ts->api->serialize_response(ts, -err, NULL);
-            }
+    const struct thingset_data_object *fn = ts->endpoint.object;
+    unsigned int pos;
+    for (struct thingset_data_object *param = thingset_get_first_child(ts, fn, &pos);
+         param != NULL; param = thingset_get_next_child(ts, fn, &pos))
+    {
+        err = ts->api->deserialize_value(ts, param, false);
+        if (err == -THINGSET_ERR_DESERIALIZATION_FINISHED) {
+            /* more child objects found than parameters were passed */
+            return ts->api->serialize_response(ts, THINGSET_ERR_BAD_REQUEST,
+                                               "Not enough parameters");
+        }
+        else if (err != 0) {
+            /* deserializing the value was not successful */
+            return ts->api->serialize_response(ts, -err, NULL);
         }
     }
 
@@ -470,11 +997,15 @@ int thingset_common_create_delete(struct thingset_context *ts, bool create)
         int ret = thingset_endpoint_by_path(ts, &element, str_start, str_len);
         if (ret >= 0 && element.index == THINGSET_ENDPOINT_INDEX_NONE) {
             if (create) {
-                element.object->subsets |= ts->endpoint.object->data.subset;
+                thingset_set_object_subsets(ts, element.object,
+                                            element.object->subsets
+                                                | ts->endpoint.object->data.subset);
                 return ts->api->serialize_response(ts, THINGSET_STATUS_CREATED, NULL);
             }
             else {
-                element.object->subsets &= ~ts->endpoint.object->data.subset;
+                thingset_set_object_subsets(ts, element.object,
+                                            element.object->subsets
+                                                & ~ts->endpoint.object->data.subset);
                 return ts->api->serialize_response(ts, THINGSET_STATUS_DELETED, NULL);
             }
         }
@@ -24,6 +24,14 @@ extern "C" {
  * Also deserialize functions return 0 or negative error code, but never store any error response
  * in the buffer.
  */
+/**
+ * Number of elements to pass to the map serialization functions if it is not known in advance.
+ *
+ * Binary mode reserves space for the header of a map with up to UINT8_MAX elements in this case
+ * and shrinks it when closing the map, so nested maps should pass their exact size instead.
+ */
+#define THINGSET_NUM_ELEMENTS_UNKNOWN UINT8_MAX
+
 struct thingset_api
 {
     /**
@@ -81,6 +89,20 @@ struct thingset_api
                               const struct thingset_data_object *object);
 #endif /* CONFIG_THINGSET_METADATA_ENDPOINT */
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    /**
+     * Serialize the path of the specified data object as a map key. For binary mode, the ID is
+     * used instead of the path if the use_ids parameter of the endpoint is set.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param object Pointer to data object
+     *
+     * @returns 0 for success or negative ThingSet response code in case of error
+     */
+    int (*serialize_path_key)(struct thingset_context *ts,
+                              const struct thingset_data_object *object);
+#endif /* CONFIG_THINGSET_CHANGES_ENDPOINT */
+
     /**
      * Serialize the key and value of the specified data object.
      *
@@ -96,19 +118,21 @@ struct thingset_api
      * Serialize the start of a map (`{` for text mode).
      *
      * @param ts Pointer to ThingSet context
+     * @param num_elements Number of key/value pairs or THINGSET_NUM_ELEMENTS_UNKNOWN
      *
      * @returns 0 for success or negative ThingSet response code in case of error
      */
-    int (*serialize_map_start)(struct thingset_context *ts);
+    int (*serialize_map_start)(struct thingset_context *ts, size_t num_elements);
 
     /**
      * Serialize the end of a map (`}` for text mode).
      *
      * @param ts Pointer to ThingSet context
+     * @param num_elements Same value as passed to serialize_map_start
      *
      * @returns 0 for success or negative ThingSet response code in case of error
      */
-    int (*serialize_map_end)(struct thingset_context *ts);
+    int (*serialize_map_end)(struct thingset_context *ts, size_t num_elements);
 
     /**
      * Serialize the start of a list/array (`[` for text mode).
@@ -154,6 +178,35 @@ struct thingset_api
      */
     int (*serialize_report_header)(struct thingset_context *ts, const char *path);
 
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    /**
+     * Serialize the static parts of a report (header, keys and separators) into the buffer of a
+     * report template.
+     *
+     * The members of the template have to be determined before calling this function.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param tmpl Pointer to the report template
+     * @param path Path string for the report header or NULL to keep the existing header
+     *
+     * @returns 0 for success or negative ThingSet response code in case of error
+     */
+    int (*prepare_report_template)(struct thingset_context *ts,
+                                   struct thingset_report_template *tmpl, const char *path);
+
+    /**
+     * Serialize a report by copying the static parts from a report template and serializing
+     * only the values of the members.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param tmpl Pointer to the report template
+     *
+     * @returns 0 for success or negative ThingSet response code in case of error
+     */
+    int (*serialize_report_template)(struct thingset_context *ts,
+                                     const struct thingset_report_template *tmpl);
+#endif
+
     /**
      * Finalize serialization
      *
@@ -161,6 +214,86 @@ struct thingset_api
      */
     void (*serialize_finish)(struct thingset_context *ts);
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    /**
+     * Get the length of the data serialized into the response buffer so far.
+     *
+     * @param ts Pointer to ThingSet context
+     *
+     * @returns Current length of the response
+     */
+    size_t (*serialize_length)(struct thingset_context *ts);
+
+    /**
+     * Discard the data serialized into the response buffer behind the given length.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param len Length of the response to keep, as obtained with serialize_length
+     */
+    void (*serialize_truncate)(struct thingset_context *ts, size_t len);
+#endif
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+    /**
+     * Calculate the length of the serialized key of the specified data object.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param object Pointer to data object
+     *
+     * @returns Length of the key
+     */
+    size_t (*key_size)(struct thingset_context *ts, const struct thingset_data_object *object);
+
+    /**
+     * Calculate the length of the serialized value of the specified data object without
+     * serializing it.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param object Pointer to data object
+     * @param report True if the value is part of a report (records are serialized entirely)
+     * @param max True for the maximum length independent of the current value
+     *
+     * @returns Length of the value including separators
+     */
+    size_t (*value_size)(struct thingset_context *ts, const struct thingset_data_object *object,
+                         bool report, bool max);
+
+    /**
+     * Calculate the length of the start and end of a map or list.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param num_elements Number of elements in the map or list
+     * @param max True for the maximum length (e.g. with space reserved for the header)
+     *
+     * @returns Length of the start and end
+     */
+    size_t (*container_size)(struct thingset_context *ts, size_t num_elements, bool max);
+
+    /**
+     * Calculate the length of the serialized payload data for the specified subset without
+     * serializing it.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param subsets Subset(s) to be considered
+     * @param report True if the subset is part of a report
+     * @param max True for the maximum length independent of the current values
+     *
+     * @returns Length of the payload data
+     */
+    size_t (*subsets_size)(struct thingset_context *ts, uint16_t subsets, bool report, bool max);
+
+    /**
+     * Calculate the length of the start of a report message.
+     *
+     * @param ts Pointer to ThingSet context
+     * @param path Path string
+     * @param max True for the maximum length (e.g. with space reserved for the header)
+     *
+     * @returns Length of the report header
+     */
+    size_t (*report_header_size)(struct thingset_context *ts, const char *path, bool max);
+#endif
+
     /**
      * Reset payload deserialization to start parsing at beginning of payload.
      *
@@ -274,6 +407,77 @@ int thingset_bin_serialize_response(struct thingset_context *ts, uint8_t code, c
 int thingset_txt_serialize_response(struct thingset_context *ts, uint8_t code, const char *msg,
                                     ...);
 
+/**
+ * Format an unsigned integer as decimal string without using printf-family functions.
+ *
+ * The digits are calculated two at a time using a lookup table, which is significantly faster
+ * than snprintf on small microcontrollers.
+ *
+ * @param buf Pointer to the buffer to store the null-terminated string.
+ * @param size Size of the buffer.
+ * @param value Value to be formatted.
+ *
+ * @return Length of the string (without null-termination). Similar to snprintf, nothing is
+ *         written and a value >= size is returned if the buffer is too small.
+ */
+int thingset_txt_format_u32(char *buf, size_t size, uint32_t value);
+
+/**
+ * Format a signed integer as decimal string (see thingset_txt_format_u32).
+ */
+int thingset_txt_format_i32(char *buf, size_t size, int32_t value);
+
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+
+/**
+ * Format a 64-bit unsigned integer as decimal string (see thingset_txt_format_u32).
+ */
+int thingset_txt_format_u64(char *buf, size_t size, uint64_t value);
+
+/**
+ * Format a 64-bit signed integer as decimal string (see thingset_txt_format_u32).
+ */
+int thingset_txt_format_i64(char *buf, size_t size, int64_t value);
+
+#endif
+
+/**
+ * Format a float with a fixed number of decimals without using printf-family functions or
+ * double-precision arithmetics.
+ *
+ * The value is rounded correctly (ties to even), so the result is identical to snprintf with
+ * "%.*f" format for up to 9 decimals. More decimals are not supported and reduced to 9 (the
+ * item macros reject them already at build time).
+ *
+ * @param buf Pointer to the buffer to store the null-terminated string.
+ * @param size Size of the buffer.
+ * @param value Value to be formatted (must not be NaN or infinite).
+ * @param decimals Number of decimals or THINGSET_DECIMALS_SHORTEST to use the smallest number
+ *                 of decimals (max. 9) for which the string is parsed as the same float again.
+ *
+ * @return Length of the string (without null-termination). Similar to snprintf, nothing is
+ *         written and a value >= size is returned if the buffer is too small.
+ */
+int thingset_txt_format_f32(char *buf, size_t size, float value, int decimals);
+
+/**
+ * Parse a JSON number directly into a data object of the specified type.
+ *
+ * The buffer does not have to be null-terminated. Integers are parsed exactly (fractional digits
+ * are truncated) and have to be within the range of the type. Floats are rounded correctly for
+ * up to 19 significant digits. Decimal fractions are scaled without conversion to float.
+ *
+ * @param buf Pointer to the start of the number.
+ * @param len Length of the number.
+ * @param data Pointer to the variable to store the value (only written in case of success).
+ * @param type Type of the data object (F32, DECFRAC or one of the integer types).
+ * @param detail Detail of the data object (exponent for DECFRAC).
+ *
+ * @return 0 for success or negative ThingSet response code in case of error
+ */
+int thingset_txt_parse_number(const char *buf, size_t len, union thingset_data_pointer data,
+                              int type, int detail);
+
 /**
  * Get the child object from a provided parent ID and the child name.
  *
@@ -288,6 +492,114 @@ struct thingset_data_object *thingset_get_child_by_name(struct thingset_context
                                                         uint16_t parent_id, const char *name,
                                                         size_t len);
 
+/**
+ * Get the first child of a parent object and start iterating over its children.
+ *
+ * The children are returned in the order of the object database. If CONFIG_THINGSET_CHILD_INDEX
+ * is enabled, the precomputed child index is used instead of scanning all data objects.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param parent Pointer to the parent object (may also be the root object or a temporary copy).
+ * @param pos Pointer to iteration state, to be passed to thingset_get_next_child.
+ *
+ * @return Pointer to the first child object or NULL if the parent has no children
+ */
+struct thingset_data_object *thingset_get_first_child(struct thingset_context *ts,
+                                                      const struct thingset_data_object *parent,
+                                                      unsigned int *pos);
+
+/**
+ * Get the next child of a parent object.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param parent Pointer to the parent object.
+ * @param pos Pointer to iteration state initialized by thingset_get_first_child.
+ *
+ * @return Pointer to the next child object or NULL if there are no more children
+ */
+struct thingset_data_object *thingset_get_next_child(struct thingset_context *ts,
+                                                     const struct thingset_data_object *parent,
+                                                     unsigned int *pos);
+
+/**
+ * Get the first field (record item) of a records object and start iterating over its fields.
+ *
+ * If CONFIG_THINGSET_RECORD_FIELD_CACHE is enabled, the cached field list is used instead of
+ * iterating over the children in the data objects database.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param records Pointer to an object of type THINGSET_TYPE_RECORDS (may also be a temporary
+ *                copy).
+ * @param pos Pointer to iteration state, to be passed to thingset_get_next_record_field.
+ *
+ * @return Pointer to the first field or NULL if the records object has no fields
+ */
+struct thingset_data_object *thingset_get_first_record_field(
+    struct thingset_context *ts, const struct thingset_data_object *records, unsigned int *pos);
+
+/**
+ * Get the next field (record item) of a records object.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param records Pointer to the records object.
+ * @param pos Pointer to iteration state initialized by thingset_get_first_record_field.
+ *
+ * @return Pointer to the next field or NULL if there are no more fields
+ */
+struct thingset_data_object *thingset_get_next_record_field(
+    struct thingset_context *ts, const struct thingset_data_object *records, unsigned int *pos);
+
+/**
+ * Count the fields (record items) of a records object.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param records Pointer to an object of type THINGSET_TYPE_RECORDS.
+ *
+ * @return Number of fields
+ */
+size_t thingset_count_record_fields(struct thingset_context *ts,
+                                    const struct thingset_data_object *records);
+
+/**
+ * Get the index of the next data object belonging to at least one of the given subsets.
+ *
+ * If CONFIG_THINGSET_SUBSET_INDEX is enabled, the precomputed subset lists are used instead of
+ * scanning all data objects.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param subsets Flags of the subset(s) to be considered.
+ * @param index Index in the data objects array to start searching from (inclusive).
+ *
+ * @return Index of the next member or ts->num_objects if there are no more members
+ */
+unsigned int thingset_next_subset_member(struct thingset_context *ts, uint16_t subsets,
+                                         unsigned int index);
+
+/**
+ * Count the data objects belonging to at least one of the given subsets.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param subsets Flags of the subset(s) to be considered.
+ *
+ * @return Number of data objects in the subset(s)
+ */
+size_t thingset_count_subset_members(struct thingset_context *ts, uint16_t subsets);
+
+#ifndef CONFIG_THINGSET_IMMUTABLE_OBJECTS
+/**
+ * Change the subsets of a data object.
+ *
+ * This function has to be used instead of assigning object->subsets directly in order to keep
+ * the subset lists consistent.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Pointer to the data object.
+ * @param subsets New subset flags of the data object.
+ */
+void thingset_set_object_subsets(struct thingset_context *ts, struct thingset_data_object *object,
+                                 uint16_t subsets);
+#endif
+
 /**
  * Get the object by ID.
  *
@@ -298,6 +610,127 @@ struct thingset_data_object *thingset_get_child_by_name(struct thingset_context
  */
 struct thingset_data_object *thingset_get_object_by_id(struct thingset_context *ts, uint16_t id);
 
+/**
+ * Check if a report is currently serialized.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param type First character of the report (e.g. THINGSET_TXT_REPORT)
+ *
+ * @returns True if the response buffer contains a report
+ */
+static inline bool thingset_serializing_report(struct thingset_context *ts, uint8_t type)
+{
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    if (ts->sink != NULL && ts->sink_flushed > 0) {
+        /* the first character was already passed to the sink */
+        return ts->sink_report;
+    }
+#endif
+
+    return ts->rsp[0] == type;
+}
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+/**
+ * Pass the data serialized into the staging buffer to the flush function of the sink.
+ *
+ * The last bytes of the data can be kept, e.g. because they may still be overwritten by the
+ * following serialization steps. They are moved to the beginning of the staging buffer.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param len Length of the data in the staging buffer
+ * @param keep Number of bytes at the end of the data to keep in the staging buffer
+ *
+ * @return 0 for success or the error code returned by the flush function
+ */
+int thingset_sink_flush(struct thingset_context *ts, size_t len, size_t keep);
+#endif
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+/**
+ * Discard the consumed data from the window buffer of the source and read more data.
+ *
+ * This function is called if the data item following the consumed data is incomplete.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param consumed Number of bytes at the beginning of the window buffer already imported
+ *
+ * @return 0 for success, -THINGSET_ERR_REQUEST_TOO_LARGE if a single item does not fit into the
+ *         window buffer, -THINGSET_ERR_BAD_REQUEST if the data ended before the item was complete
+ *         or the error code returned by the read function
+ */
+int thingset_source_refill(struct thingset_context *ts, size_t consumed);
+
+/**
+ * Find the data object for a key of imported data.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param parent Group of the map containing the key or NULL for the top-level map, which also
+ *               accepts paths
+ * @param name Name of the data object (not null-terminated)
+ * @param len Length of the name
+ *
+ * @return Pointer to the data object or NULL if it was not found
+ */
+const struct thingset_data_object *thingset_source_lookup(struct thingset_context *ts,
+                                                          const struct thingset_data_object *parent,
+                                                          const char *name, size_t len);
+
+/**
+ * Write the value at the current position of the deserializer to the data object if the
+ * authentication flags allow it.
+ *
+ * Errors are silently ignored, as for thingset_import_data().
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Data object to be updated
+ * @param auth_flags Authentication flags to be used for the import
+ */
+void thingset_source_import_value(struct thingset_context *ts,
+                                  const struct thingset_data_object *object, uint8_t auth_flags);
+#endif
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+/**
+ * Append a segment to the scatter-gather export.
+ *
+ * The data serialized into the response buffer since the previous segment is stored as a
+ * segment of its own first.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param end End of the data serialized into the response buffer
+ * @param base Pointer to the data of the new segment (NULL to store the pending data only)
+ * @param len Length of the new segment
+ *
+ * @return 0 for success or -THINGSET_ERR_RESPONSE_TOO_LARGE if there are not enough segments
+ */
+int thingset_iovec_append(struct thingset_context *ts, const uint8_t *end, const uint8_t *base,
+                          size_t len);
+#endif
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+/**
+ * Increment the data version and store it as the version of the last change of the data object.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Pointer to the changed data object
+ */
+void thingset_object_changed(struct thingset_context *ts,
+                             const struct thingset_data_object *object);
+
+/**
+ * Find the next data object changed after the specified data version.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param version Data version received by the client with the previous request
+ * @param index Index of the data object to start searching from
+ *
+ * @return Index of the changed data object or ts->num_objects if no further object was changed
+ */
+unsigned int thingset_next_changed_object(struct thingset_context *ts, uint32_t version,
+                                          unsigned int index);
+#endif
+
 /**
  * Get an object by its path.
  *
@@ -323,6 +756,30 @@ struct thingset_data_object *thingset_get_object_by_path(struct thingset_context
 int thingset_get_path(struct thingset_context *ts, char *buf, size_t size,
                       const struct thingset_data_object *obj);
 
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+/**
+ * Get the length of the relative path of an object.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param obj Pointer to the object to get the path length of.
+ *
+ * @return Length of the path
+ */
+size_t thingset_get_path_length(struct thingset_context *ts,
+                                const struct thingset_data_object *obj);
+#endif
+
+/**
+ * Get the length of the name of a data object (from the key cache if available).
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Pointer to the data object.
+ *
+ * @return Length of the name
+ */
+size_t thingset_get_name_length(struct thingset_context *ts,
+                                const struct thingset_data_object *object);
+
 /**
  * Gets the type of a given object as a string.
  *
@@ -352,8 +809,42 @@ int thingset_txt_desire(struct thingset_context *ts);
  */
 int thingset_txt_process(struct thingset_context *ts);
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+/**
+ * Serialize the next piece of a continued response in text mode.
+ *
+ * The comma following the last element of a piece is withheld and sent at the beginning of the
+ * next piece, as it has to be replaced by the closing bracket after the last element.
+ *
+ * @param ts Pointer to ThingSet context.
+ *
+ * @return see thingset_process_continue.
+ */
+int thingset_txt_process_continue(struct thingset_context *ts);
+#endif
+
 void thingset_txt_setup(struct thingset_context *ts);
 
+/**
+ * Export the next chunk of subset members in text mode.
+ *
+ * The comma following the last member of a chunk is withheld and sent with the next chunk, as it
+ * has to be replaced by a bracket if the following member belongs to a different parent object.
+ *
+ * @returns 1 if there are more objects to export, 0 when complete or negative if an error.
+ */
+int thingset_txt_export_subsets_progressively(struct thingset_context *ts, uint16_t subsets,
+                                              unsigned int *index, size_t *len);
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+/**
+ * Import data pulled from the source in the context in text mode.
+ *
+ * @returns 0 for success or negative error code (see thingset_import_data_from_source)
+ */
+int thingset_txt_import_source(struct thingset_context *ts, uint8_t auth_flags);
+#endif
+
 /**
  * Process binary mode desire.
  *
@@ -372,6 +863,20 @@ int thingset_bin_desire(struct thingset_context *ts);
  */
 int thingset_bin_process(struct thingset_context *ts);
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+/**
+ * Serialize the next piece of a continued response in binary mode.
+ *
+ * The map or list of a continued response is serialized with the number of elements of the
+ * entire response in its header, so the following pieces only contain the remaining elements.
+ *
+ * @param ts Pointer to ThingSet context.
+ *
+ * @return see thingset_process_continue.
+ */
+int thingset_bin_process_continue(struct thingset_context *ts);
+#endif
+
 void thingset_bin_setup(struct thingset_context *ts, size_t buf_offset);
 
 int thingset_bin_import_data(struct thingset_context *ts, uint8_t auth_flags,
@@ -382,6 +887,25 @@ int thingset_bin_import_report(struct thingset_context *ts, uint8_t auth_flags,
 int thingset_bin_import_data_progressively(struct thingset_context *ts, uint8_t auth_flags,
                                            size_t size, uint32_t *last_id, size_t *consumed);
 
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+/**
+ * Import data pulled from the source in the context in binary mode.
+ *
+ * @returns 0 for success or negative error code (see thingset_import_data_from_source)
+ */
+int thingset_bin_import_source(struct thingset_context *ts, uint8_t auth_flags);
+#endif
+
+#if defined(CONFIG_THINGSET_REPORT_TEMPLATES) && defined(CONFIG_THINGSET_REPORT_FIXED_WIDTH)
+/**
+ * Overwrite the values of a fixed-width binary report rendered from the template.
+ *
+ * @returns 0 for success or negative ThingSet response code in case of error
+ */
+int thingset_bin_patch_report(struct thingset_context *ts,
+                              const struct thingset_report_template *tmpl);
+#endif
+
 int thingset_bin_export_subsets_progressively(struct thingset_context *ts, uint16_t subsets,
                                               unsigned int *index, size_t *len);
 
@@ -389,7 +913,38 @@ int thingset_common_serialize_group(struct thingset_context *ts,
                                     const struct thingset_data_object *object);
 
 int thingset_common_serialize_record(struct thingset_context *ts,
-                                     const struct thingset_data_object *object, int record_index);
+                                     const struct thingset_data_object *object, int record_index,
+                                     size_t num_fields);
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+/**
+ * Calculate the length of a serialized group with all readable children.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Pointer to the group
+ * @param report True if the group is part of a report
+ * @param max True for the maximum length independent of the current values
+ *
+ * @return Length of the group
+ */
+size_t thingset_common_group_size(struct thingset_context *ts,
+                                  const struct thingset_data_object *object, bool report, bool max);
+
+/**
+ * Calculate the length of a single serialized record.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param object Pointer to the records object
+ * @param record_index Index of the record (ignored for the maximum length)
+ * @param report True if the record is part of a report
+ * @param max True for the maximum length independent of the current values
+ *
+ * @return Length of the record
+ */
+size_t thingset_common_record_size(struct thingset_context *ts,
+                                   const struct thingset_data_object *object, int record_index,
+                                   bool report, bool max);
+#endif
 
 typedef int (*thingset_common_record_element_action)(
     struct thingset_context *ts, const struct thingset_data_object *item_offset);
@@ -417,6 +972,32 @@ int thingset_common_get(struct thingset_context *ts);
  */
 int thingset_common_fetch(struct thingset_context *ts);
 
+/* Types of responses which can be continued in multiple pieces */
+enum thingset_continuation_type
+{
+    THINGSET_CONT_NONE = 0,
+    THINGSET_CONT_GROUP,  /**< Map with the children of a group (GET) */
+    THINGSET_CONT_RECORD, /**< Map with the fields of a record (GET) */
+    THINGSET_CONT_NAMES,  /**< List with the names of the children of a group (FETCH) */
+    THINGSET_CONT_VALUES, /**< List with the requested values (FETCH) */
+};
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+/**
+ * Serialize the remaining elements of a continued response.
+ *
+ * After the last element, the map or list is only closed if requested (text mode), as binary
+ * mode uses the number of elements in the header instead.
+ *
+ * @param ts Pointer to ThingSet context.
+ * @param close True if the map or list has to be closed after the last element
+ *
+ * @return 0 if the response is complete, -THINGSET_ERR_RESPONSE_CONTINUED if it has to be
+ *         continued in a further piece or negative ThingSet response code in case of error
+ */
+int thingset_common_continue(struct thingset_context *ts, bool close);
+#endif
+
 /**
  * Process UPDATE request.
  *
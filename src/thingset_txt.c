@@ -11,7 +11,6 @@
 
 #include "thingset_internal.h"
 
-#include <errno.h>
 #include <inttypes.h>
 #include <math.h>
 #include <stdarg.h>
@@ -29,7 +28,7 @@
 
 static inline int txt_serialize_start(struct thingset_context *ts, char c)
 {
-    if (ts->rsp_size > ts->rsp_pos + 2) {
+    if (ts->rsp_pos < ts->rsp_size) {
         ts->rsp[ts->rsp_pos++] = c;
         return 0;
     }
@@ -41,8 +40,11 @@ static inline int txt_serialize_start(struct thingset_context *ts, char c)
 
 static inline int txt_serialize_end(struct thingset_context *ts, char c)
 {
-    if (ts->rsp_size > ts->rsp_pos + 3) {
-        if (ts->rsp[ts->rsp_pos - 1] == ',') {
+    /* the comma after the last element (if any) is replaced by the bracket */
+    bool empty = ts->rsp[ts->rsp_pos - 1] != ',';
+
+    if (ts->rsp_pos + (empty ? 2 : 1) <= ts->rsp_size) {
+        if (!empty) {
             ts->rsp_pos--;
         }
         ts->rsp[ts->rsp_pos++] = c;
@@ -55,12 +57,12 @@ static inline int txt_serialize_end(struct thingset_context *ts, char c)
     }
 }
 
-static int txt_serialize_map_start(struct thingset_context *ts)
+static int txt_serialize_map_start(struct thingset_context *ts, size_t num_elements)
 {
     return txt_serialize_start(ts, '{');
 }
 
-static int txt_serialize_map_end(struct thingset_context *ts)
+static int txt_serialize_map_end(struct thingset_context *ts, size_t num_elements)
 {
     return txt_serialize_end(ts, '}');
 }
@@ -100,6 +102,335 @@ static int txt_serialize_response(struct thingset_context *ts, uint8_t code, con
     return 0;
 }
 
+/* two ASCII digits for each number from 0 to 99 */
+static const char digit_pairs[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+static inline int count_digits_u32(uint32_t value)
+{
+    int digits = 1;
+
+    while (value >= 100) {
+        value /= 100;
+        digits += 2;
+    }
+
+    return value >= 10 ? digits + 1 : digits;
+}
+
+/* writes the digits of the value backwards, ending right before the end pointer */
+static inline void write_digits_u32(char *end, uint32_t value)
+{
+    while (value >= 100) {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        *--end = digit_pairs[pair + 1];
+        *--end = digit_pairs[pair];
+    }
+
+    if (value >= 10) {
+        *--end = digit_pairs[value * 2 + 1];
+        *--end = digit_pairs[value * 2];
+    }
+    else {
+        *--end = '0' + value;
+    }
+}
+
+static int format_u32(char *buf, size_t size, uint32_t value, bool negative)
+{
+    int len = count_digits_u32(value) + negative;
+
+    if (len < size) {
+        if (negative) {
+            buf[0] = '-';
+        }
+        write_digits_u32(buf + len, value);
+        buf[len] = '\0';
+    }
+
+    return len;
+}
+
+int thingset_txt_format_u32(char *buf, size_t size, uint32_t value)
+{
+    return format_u32(buf, size, value, false);
+}
+
+int thingset_txt_format_i32(char *buf, size_t size, int32_t value)
+{
+    /* calculated in unsigned arithmetics to avoid overflow for INT32_MIN */
+    return value < 0 ? format_u32(buf, size, 0U - (uint32_t)value, true)
+                     : format_u32(buf, size, value, false);
+}
+
+/* 9 digit chunk size used for numbers that do not fit into uint32_t */
+#define CHUNK_DIVISOR 1000000000U
+#define CHUNK_DIGITS  9
+
+/* chunks are stored with the least significant chunk first, the most significant chunk may have
+ * more than 9 digits */
+static int format_chunks(char *buf, size_t size, const uint32_t *chunks, int num_chunks,
+                         bool negative)
+{
+    int len = count_digits_u32(chunks[num_chunks - 1]) + (num_chunks - 1) * CHUNK_DIGITS + negative;
+
+    if (len < size) {
+        char *end = buf + len;
+        if (negative) {
+            buf[0] = '-';
+        }
+        /* leading zeros of the lower chunks are written by pre-filling with zeros */
+        memset(buf + negative, '0', len - negative);
+        for (int i = 0; i < num_chunks; i++) {
+            write_digits_u32(end, chunks[i]);
+            end -= CHUNK_DIGITS;
+        }
+        buf[len] = '\0';
+    }
+
+    return len;
+}
+
+static int format_u64(char *buf, size_t size, uint64_t value, bool negative)
+{
+    uint32_t chunks[3];
+    int num_chunks = 0;
+
+    /* the expensive 64-bit division is needed at most twice, the remaining digits are
+     * calculated with 32-bit arithmetics */
+    while (value > UINT32_MAX) {
+        chunks[num_chunks++] = value % CHUNK_DIVISOR;
+        value /= CHUNK_DIVISOR;
+    }
+
+    if (num_chunks == 0) {
+        return format_u32(buf, size, (uint32_t)value, negative);
+    }
+
+    chunks[num_chunks++] = (uint32_t)value;
+
+    return format_chunks(buf, size, chunks, num_chunks, negative);
+}
+
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+
+int thingset_txt_format_u64(char *buf, size_t size, uint64_t value)
+{
+    return format_u64(buf, size, value, false);
+}
+
+int thingset_txt_format_i64(char *buf, size_t size, int64_t value)
+{
+    return value < 0 ? format_u64(buf, size, 0U - (uint64_t)value, true)
+                     : format_u64(buf, size, value, false);
+}
+
+#endif /* CONFIG_THINGSET_64BIT_TYPES_SUPPORT */
+
+static const uint32_t pow10_u32[THINGSET_DECIMALS_MAX + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+/*
+ * Integer value mantissa * 2^exponent of a float that does not fit into uint64_t (up to 128 bits).
+ */
+static int format_f32_integer_large(char *buf, size_t size, uint32_t mantissa, int exponent,
+                                    bool negative)
+{
+    /* 32-bit words, least significant word first */
+    uint32_t words[5] = { 0 };
+    uint32_t chunks[5];
+    int num_chunks = 0;
+    int top = exponent / 32;
+
+    words[top] = mantissa << (exponent % 32);
+    if (exponent % 32 > 8) {
+        words[++top] = mantissa >> (32 - exponent % 32);
+    }
+
+    /* long division by the chunk divisor until the remaining value fits into a single word */
+    while (top > 0) {
+        uint64_t rem = 0;
+        for (int i = top; i >= 0; i--) {
+            uint64_t cur = (rem << 32) | words[i];
+            words[i] = cur / CHUNK_DIVISOR;
+            rem = cur % CHUNK_DIVISOR;
+        }
+        chunks[num_chunks++] = rem;
+        if (words[top] == 0) {
+            top--;
+        }
+    }
+    chunks[num_chunks++] = words[0];
+
+    return format_chunks(buf, size, chunks, num_chunks, negative);
+}
+
+/*
+ * Calculates value / 2^shift rounded to nearest (ties to even, same as printf) and stores the
+ * absolute rounding error in units of 2^-shift.
+ */
+static uint64_t round_shift(uint64_t value, int shift, uint64_t *error, bool *rounded_up)
+{
+    if (shift >= 64) {
+        /* value is below 2^54 (see callers), so result rounds to zero */
+        *error = value;
+        *rounded_up = false;
+        return 0;
+    }
+
+    uint64_t quotient = value >> shift;
+    uint64_t remainder = value & ((1ULL << shift) - 1);
+    uint64_t half = 1ULL << (shift - 1);
+
+    if (remainder > half || (remainder == half && (quotient & 1))) {
+        *error = (1ULL << shift) - remainder;
+        *rounded_up = true;
+        return quotient + 1;
+    }
+    else {
+        *error = remainder;
+        *rounded_up = false;
+        return quotient;
+    }
+}
+
+/*
+ * Find the smallest number of decimals, so that parsing the formatted value results in the same
+ * float value again (mantissa * 2^-shift).
+ */
+static int f32_shortest_decimals(uint32_t mantissa, int shift, bool narrow_lower_interval)
+{
+    for (int decimals = 0; decimals < THINGSET_DECIMALS_MAX; decimals++) {
+        uint64_t error;
+        bool rounded_up;
+        round_shift((uint64_t)mantissa * pow10_u32[decimals], shift, &error, &rounded_up);
+
+        /* the decimal number is accepted if it is within half a unit in the last place of the
+         * float, where ties are resolved to the even mantissa when parsing */
+        uint64_t limit = pow10_u32[decimals];
+        uint64_t scaled_error = (narrow_lower_interval && !rounded_up) ? error * 4 : error * 2;
+        if (scaled_error < limit || (scaled_error == limit && (mantissa & 1) == 0)) {
+            return decimals;
+        }
+    }
+
+    return THINGSET_DECIMALS_MAX;
+}
+
+int thingset_txt_format_f32(char *buf, size_t size, float value, int decimals)
+{
+    uint32_t bits;
+    uint32_t mantissa;
+    uint32_t fraction = 0;
+    bool negative;
+    int biased_exp;
+    int exponent;
+    int len;
+
+    memcpy(&bits, &value, sizeof(bits));
+    negative = bits >> 31;
+    biased_exp = (bits >> 23) & 0xFF;
+    mantissa = bits & 0x7FFFFF;
+
+    if (biased_exp == 0) {
+        /* subnormal number */
+        exponent = -149;
+    }
+    else {
+        mantissa |= 0x800000;
+        exponent = biased_exp - 150;
+    }
+
+    if (decimals > THINGSET_DECIMALS_MAX) {
+        decimals = THINGSET_DECIMALS_MAX;
+    }
+
+    if (exponent >= 0) {
+        /* integer value without fractional part */
+        if (decimals < 0) {
+            decimals = 0;
+        }
+        if (exponent < 40) {
+            len = format_u64(buf, size, (uint64_t)mantissa << exponent, negative);
+        }
+        else {
+            len = format_f32_integer_large(buf, size, mantissa, exponent, negative);
+        }
+    }
+    else {
+        uint64_t error;
+        bool rounded_up;
+        if (decimals < 0) {
+            /* power of 2 with the next smaller float closer than the next larger float */
+            bool narrow_lower_interval = (bits & 0x7FFFFF) == 0 && biased_exp > 1;
+            decimals = f32_shortest_decimals(mantissa, -exponent, narrow_lower_interval);
+        }
+        /* below 2^54, so no overflow possible */
+        uint64_t scaled =
+            round_shift((uint64_t)mantissa * pow10_u32[decimals], -exponent, &error, &rounded_up);
+        fraction = scaled % pow10_u32[decimals];
+        len = format_u64(buf, size, scaled / pow10_u32[decimals], negative);
+    }
+
+    if (decimals > 0) {
+        if (len + 1 + decimals < size) {
+            buf[len] = '.';
+            memset(buf + len + 1, '0', decimals);
+            write_digits_u32(buf + len + 1 + decimals, fraction);
+            buf[len + 1 + decimals] = '\0';
+        }
+        len += 1 + decimals;
+    }
+
+    return len;
+}
+
+/**
+ * Append a comma to the already serialized value with length pos.
+ *
+ * The comma may occupy the last byte of the buffer, as the trailing comma of the response is
+ * replaced by the null-termination in the end.
+ *
+ * @returns New length or a value > size if the buffer is too small
+ */
+static inline int json_append_comma(char *buf, size_t size, int pos)
+{
+    if (pos < size) {
+        buf[pos] = ',';
+        if (pos + 1 < size) {
+            buf[pos + 1] = '\0';
+        }
+    }
+
+    return pos + 1;
+}
+
+/**
+ * Append a string without null-termination to the already serialized data with length pos.
+ *
+ * @returns New length or a value > size if the buffer is too small
+ */
+static inline int json_append(char *buf, size_t size, int pos, const char *str)
+{
+    size_t len = strlen(str);
+
+    if (pos + len <= size) {
+        memcpy(buf + pos, str, len);
+    }
+
+    return pos + len;
+}
+
 /**
  * @returns Number of serialized bytes or negative ThingSet reponse code in case of error
  */
@@ -111,62 +442,66 @@ static int json_serialize_simple_value(char *buf, size_t size, union thingset_da
     switch (type) {
 #if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
         case THINGSET_TYPE_U64:
-            pos = snprintf(buf, size, "%" PRIu64 ",", *data.u64);
+            pos = json_append_comma(buf, size, thingset_txt_format_u64(buf, size, *data.u64));
             break;
         case THINGSET_TYPE_I64:
-            pos = snprintf(buf, size, "%" PRIi64 ",", *data.i64);
+            pos = json_append_comma(buf, size, thingset_txt_format_i64(buf, size, *data.i64));
             break;
 #endif
         case THINGSET_TYPE_U32:
-            pos = snprintf(buf, size, "%" PRIu32 ",", *data.u32);
+            pos = json_append_comma(buf, size, thingset_txt_format_u32(buf, size, *data.u32));
             break;
         case THINGSET_TYPE_I32:
-            pos = snprintf(buf, size, "%" PRIi32 ",", *data.i32);
+            pos = json_append_comma(buf, size, thingset_txt_format_i32(buf, size, *data.i32));
             break;
         case THINGSET_TYPE_U16:
-            pos = snprintf(buf, size, "%" PRIu16 ",", *data.u16);
+            pos = json_append_comma(buf, size, thingset_txt_format_u32(buf, size, *data.u16));
             break;
         case THINGSET_TYPE_I16:
-            pos = snprintf(buf, size, "%" PRIi16 ",", *data.i16);
+            pos = json_append_comma(buf, size, thingset_txt_format_i32(buf, size, *data.i16));
             break;
         case THINGSET_TYPE_U8:
-            pos = snprintf(buf, size, "%" PRIu8 ",", *data.u8);
+            pos = json_append_comma(buf, size, thingset_txt_format_u32(buf, size, *data.u8));
             break;
         case THINGSET_TYPE_I8:
-            pos = snprintf(buf, size, "%" PRIi8 ",", *data.i8);
+            pos = json_append_comma(buf, size, thingset_txt_format_i32(buf, size, *data.i8));
             break;
         case THINGSET_TYPE_F32:
             if (isnan(*data.f32) || isinf(*data.f32)) {
                 /* JSON spec does not support NaN and Inf, so we need to use null instead */
-                pos = snprintf(buf, size, "null,");
+                pos = json_append(buf, size, 0, "null,");
                 break;
             }
             else {
-                /* explicit double-conversion required to please compiler */
-                pos = snprintf(buf, size, "%.*f,", detail, (double)*data.f32);
+                pos = thingset_txt_format_f32(buf, size, *data.f32, detail);
+                pos = json_append_comma(buf, size, pos);
                 break;
             }
 #if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
         case THINGSET_TYPE_DECFRAC:
-            pos = snprintf(buf, size, "%" PRIi32 "e%" PRIi16 ",", *data.decfrac, -detail);
+            pos = thingset_txt_format_i32(buf, size, *data.decfrac);
+            if (pos + 1 < size) {
+                buf[pos++] = 'e';
+                pos += thingset_txt_format_i32(buf + pos, size - pos, -detail);
+            }
+            else {
+                pos = size;
+            }
+            pos = json_append_comma(buf, size, pos);
             break;
 #endif
         case THINGSET_TYPE_BOOL:
-            pos = snprintf(buf, size, "%s,", *data.b == true ? "true" : "false");
+            pos = json_append(buf, size, 0, *data.b == true ? "true," : "false,");
             break;
         case THINGSET_TYPE_STRING:
 #if CONFIG_THINGSET_JSON_STRING_ESCAPING
-            buf[0] = '"';
-            pos = 1;
-            for (int data_pos = 0; data_pos < detail; data_pos++) {
-                int remaining_chars = detail - data_pos;
-                if (pos + remaining_chars + 2 >= size) {
-                    /* indicate that the buffer is too small (similar to snprintf) and stop */
-                    pos += remaining_chars + 2;
-                    break;
-                }
-
-                if (data.str[data_pos] == '\0') {
+            pos = json_append(buf, size, 0, "\"");
+            for (int data_pos = 0; data_pos < detail && data.str[data_pos] != '\0'; data_pos++) {
+                /* escaped character as well as closing quote and comma have to fit */
+                int char_len = strchr("\\\"\b\f\n\r\t", data.str[data_pos]) != NULL ? 2 : 1;
+                if (pos + char_len + 2 > size) {
+                    /* indicate that the buffer is too small and stop */
+                    pos = size + 1;
                     break;
                 }
 
@@ -203,26 +538,29 @@ static int json_serialize_simple_value(char *buf, size_t size, union thingset_da
                         buf[pos++] = data.str[data_pos];
                 }
             }
-            buf[pos++] = '"';
-            buf[pos++] = ',';
+            pos = json_append(buf, size, pos, "\",");
 #else
-            pos = snprintf(buf, size, "\"%s\",", data.str);
+            pos = json_append(buf, size, 0, "\"");
+            pos = json_append(buf, size, pos, data.str);
+            pos = json_append(buf, size, pos, "\",");
 #endif
             break;
 #if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
         case THINGSET_TYPE_BYTES: {
             size_t strlen;
-            int err = base64_encode((uint8_t *)buf + 1, size - 4, &strlen, data.bytes->bytes,
-                                    data.bytes->num_bytes);
+            /* null-termination of the encoded data is overwritten by the closing quote */
+            int err = size > 2 ? base64_encode((uint8_t *)buf + 1, size - 2, &strlen,
+                                               data.bytes->bytes, data.bytes->num_bytes)
+                               : -ENOMEM;
             if (err == 0) {
                 buf[0] = '\"';
                 buf[strlen + 1] = '\"';
                 buf[strlen + 2] = ',';
-                buf[strlen + 3] = '\0';
                 pos = strlen + 3;
             }
             else {
-                pos = snprintf(buf, size, "null,");
+                /* the encoded data does not fit into the buffer */
+                pos = size + 1;
             }
             break;
         }
@@ -231,7 +569,7 @@ static int json_serialize_simple_value(char *buf, size_t size, union thingset_da
             return -THINGSET_ERR_UNSUPPORTED_FORMAT;
     }
 
-    if (pos >= 0 && pos < size) {
+    if (pos >= 0 && pos <= size) {
         return pos;
     }
     else {
@@ -251,79 +589,86 @@ static int txt_serialize_value(struct thingset_context *ts,
     if (pos == -THINGSET_ERR_UNSUPPORTED_FORMAT) {
         /* not a simple value */
         if (object->type == THINGSET_TYPE_GROUP) {
-            pos = snprintf(buf, size, "null,");
+            pos = json_append(buf, size, 0, "null,");
         }
         else if (object->type == THINGSET_TYPE_RECORDS) {
             if (IS_ENABLED(CONFIG_THINGSET_REPORT_RECORD_SERIALIZATION)
-                && ts->rsp[0] == THINGSET_TXT_REPORT)
+                && thingset_serializing_report(ts, THINGSET_TXT_REPORT))
             {
-                pos = snprintf(buf, size, "[");
-                ts->rsp_pos++;
-                for (unsigned int i = 0; i < object->data.records->num_records; i++) {
-                    ret = thingset_common_serialize_record(ts, object, i);
-                    pos = ts->rsp_pos;
-                    buf[pos++] = ',';
-                }
-                /* thingset_common_serialize_record has already incremeneted rsp_pos, so we reset
-                   the length of pos here, so that when we increment at the end, we are only
-                   incrementing the small delta below */
-                buf = ts->rsp + ts->rsp_pos;
-                pos = 0;
-                if (object->data.records->num_records > 0) {
-                    pos--; /* remove trailing comma */
+                /* records are serialized directly into the response buffer */
+                ret = txt_serialize_list_start(ts);
+                for (unsigned int i = 0; i < object->data.records->num_records && ret == 0; i++) {
+                    ret = thingset_common_serialize_record(ts, object, i,
+                                                           THINGSET_NUM_ELEMENTS_UNKNOWN);
                 }
-                pos += snprintf(buf + pos, size - pos, "],");
+                return ret == 0 ? txt_serialize_list_end(ts) : ret;
             }
             else {
-                pos = snprintf(buf, size, "%d,", object->data.records->num_records);
+                pos = thingset_txt_format_u32(buf, size, object->data.records->num_records);
+                pos = json_append_comma(buf, size, pos);
             }
         }
         else if (object->type == THINGSET_TYPE_FN_VOID || object->type == THINGSET_TYPE_FN_I32) {
-            pos = snprintf(buf, size, "[");
-            for (unsigned int i = 0; i < ts->num_objects; i++) {
-                if (ts->data_objects[i].parent_id == object->id) {
-                    pos += snprintf(buf + pos, size - pos, "\"%s\",", ts->data_objects[i].name);
-                }
+            pos = json_append(buf, size, 0, "[");
+            unsigned int child_pos;
+            for (struct thingset_data_object *param =
+                     thingset_get_first_child(ts, object, &child_pos);
+                 param != NULL && pos < size;
+                 param = thingset_get_next_child(ts, object, &child_pos))
+            {
+                pos = json_append(buf, size, pos, "\"");
+                pos = json_append(buf, size, pos, param->name);
+                pos = json_append(buf, size, pos, "\",");
             }
             if (pos > 1) {
                 pos--; /* remove trailing comma */
             }
-            pos += snprintf(buf + pos, size - pos, "],");
+            pos = json_append(buf, size, pos, "],");
         }
         else if (object->type == THINGSET_TYPE_SUBSET) {
-            pos = snprintf(buf, size, "[");
-            for (unsigned int i = 0; i < ts->num_objects; i++) {
-                if (ts->data_objects[i].subsets & object->data.subset) {
-                    buf[pos++] = '"';
-                    ret = thingset_get_path(ts, buf + pos, size - pos, &ts->data_objects[i]);
-                    if (ret <= 0) {
-                        ts->rsp_pos = 0;
-                        return ret;
-                    }
-                    pos += ret;
-                    buf[pos++] = '"';
-                    buf[pos++] = ',';
+            pos = json_append(buf, size, 0, "[");
+            for (unsigned int i = thingset_next_subset_member(ts, object->data.subset, 0);
+                 i < ts->num_objects && pos < size;
+                 i = thingset_next_subset_member(ts, object->data.subset, i + 1))
+            {
+                buf[pos++] = '"';
+                /* null-termination of the path is overwritten by the closing quote, so only the
+                 * comma has to be accounted for */
+                ret = pos + 1 < size ? thingset_get_path(ts, buf + pos, size - pos - 1,
+                                                         &ts->data_objects[i])
+                                     : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+                if (ret <= 0) {
+                    ts->rsp_pos = 0;
+                    return ret;
                 }
+                pos += ret;
+                buf[pos++] = '"';
+                buf[pos++] = ',';
             }
             if (pos > 1) {
                 pos--; /* remove trailing comma */
             }
-            pos += snprintf(buf + pos, size - pos, "],");
+            pos = json_append(buf, size, pos, "],");
         }
         else if (object->type == THINGSET_TYPE_ARRAY && object->data.array != NULL) {
             struct thingset_array *array = object->data.array;
-            pos = snprintf(buf, size, "[");
+            pos = json_append(buf, size, 0, "[");
             size_t type_size = thingset_type_size(array->element_type);
-            for (int i = 0; i < array->num_elements; i++) {
+            for (int i = 0; i < array->num_elements && pos < size; i++) {
                 /* using uint8_t pointer for byte-wise pointer arithmetics */
                 union thingset_data_pointer data = { .u8 = array->elements.u8 + i * type_size };
-                pos += json_serialize_simple_value(buf + pos, size - pos, data, array->element_type,
-                                                   array->decimals);
+                ret = json_serialize_simple_value(buf + pos, size - pos, data, array->element_type,
+                                                  array->decimals);
+                if (ret < 0) {
+                    ts->rsp_pos = 0;
+                    return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+                }
+                pos += ret;
             }
             if (array->num_elements > 0) {
                 pos--; /* remove trailing comma */
             }
-            pos += snprintf(buf + pos, size - pos, "],");
+            pos = json_append(buf, size, pos, "],");
         }
         else {
             ts->rsp_pos = 0;
@@ -331,7 +676,7 @@ static int txt_serialize_value(struct thingset_context *ts,
         }
     }
 
-    if (pos >= 0 && pos < size) {
+    if (pos >= 0 && pos <= size) {
         ts->rsp_pos += pos;
         return 0;
     }
@@ -353,7 +698,9 @@ static int txt_serialize_string(struct thingset_context *ts, const char *buf, bo
 {
     int len = snprintf(ts->rsp + ts->rsp_pos, ts->rsp_size - ts->rsp_pos, "\"%s\"%s", buf,
                        is_key ? ":" : ",");
-    if (len >= 0 && len < ts->rsp_size - ts->rsp_pos) {
+    if (len >= 0 && len <= ts->rsp_size - ts->rsp_pos) {
+        /* the last character may have been replaced by the null-termination */
+        ts->rsp[ts->rsp_pos + len - 1] = is_key ? ':' : ',';
         ts->rsp_pos += len;
         return 0;
     }
@@ -363,17 +710,72 @@ static int txt_serialize_string(struct thingset_context *ts, const char *buf, bo
     }
 }
 
+/**
+ * Serialize the name of a data object as a JSON key ("name":) by copying the name directly into
+ * the response buffer.
+ *
+ * @returns 0 for success or negative ThingSet reponse code in case of error
+ */
+static int txt_serialize_key(struct thingset_context *ts, const struct thingset_data_object *object)
+{
+    size_t len = thingset_get_name_length(ts, object);
+    char *buf = ts->rsp + ts->rsp_pos;
+
+    /* quotes and colon have to fit */
+    if (len + 3 <= ts->rsp_size - ts->rsp_pos) {
+        buf[0] = '"';
+        memcpy(buf + 1, object->name, len);
+        buf[len + 1] = '"';
+        buf[len + 2] = ':';
+        ts->rsp_pos += len + 3;
+        return 0;
+    }
+    else {
+        ts->rsp_pos = 0;
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+}
+
 static int txt_serialize_name(struct thingset_context *ts,
                               const struct thingset_data_object *object)
 {
     return txt_serialize_string(ts, object->name, false);
 }
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+/**
+ * Serialize the path of a data object as a JSON key ("Group/name":).
+ *
+ * @returns 0 for success or negative ThingSet reponse code in case of error
+ */
+static int txt_serialize_path_key(struct thingset_context *ts,
+                                  const struct thingset_data_object *object)
+{
+    char *buf = ts->rsp + ts->rsp_pos;
+    size_t size = ts->rsp_size - ts->rsp_pos;
+
+    /* leave space for the opening quote as well as closing quote and colon after the path */
+    int len = size > 3 ? thingset_get_path(ts, buf + 1, size - 3, object)
+                       : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    if (len >= 0) {
+        buf[0] = '"';
+        buf[len + 1] = '"';
+        buf[len + 2] = ':';
+        ts->rsp_pos += len + 3;
+        return 0;
+    }
+    else {
+        ts->rsp_pos = 0;
+        return len;
+    }
+}
+#endif
+
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
 static int txt_serialize_metadata(struct thingset_context *ts,
                                   const struct thingset_data_object *object)
 {
-    int err = txt_serialize_map_start(ts);
+    int err = txt_serialize_map_start(ts, 2);
     if (err) {
         return err;
     }
@@ -400,7 +802,7 @@ static int txt_serialize_metadata(struct thingset_context *ts,
         return -THINGSET_ERR_RESPONSE_TOO_LARGE;
     }
 
-    if ((err = txt_serialize_map_end(ts))) {
+    if ((err = txt_serialize_map_end(ts, 2))) {
         return err;
     }
 
@@ -413,7 +815,7 @@ static int txt_serialize_name_value(struct thingset_context *ts,
 {
     int err;
 
-    err = txt_serialize_string(ts, object->name, true);
+    err = txt_serialize_key(ts, object);
     if (err != 0) {
         return err;
     }
@@ -424,10 +826,26 @@ static int txt_serialize_name_value(struct thingset_context *ts,
 static void txt_serialize_finish(struct thingset_context *ts)
 {
     /* remove the trailing comma or space (in case of no payload) and terminate string */
-    ts->rsp_pos--;
+    if (ts->rsp_pos > 0) {
+        ts->rsp_pos--;
+    }
     ts->rsp[ts->rsp_pos] = '\0';
 }
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+static size_t txt_serialize_length(struct thingset_context *ts)
+{
+    return ts->rsp_pos;
+}
+
+static void txt_serialize_truncate(struct thingset_context *ts, size_t len)
+{
+    ts->rsp_pos = len;
+}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 /**
  * @returns 0 or negative ThingSet reponse code in case of error
  */
@@ -493,90 +911,472 @@ int thingset_txt_get_fetch(struct thingset_context *ts)
     }
 }
 
-static int txt_deserialize_simple_value(struct thingset_context *ts,
-                                        union thingset_data_pointer data, int type, int detail,
-                                        bool check_only)
+/* decimal number as parsed from JSON: significand * 10^exponent */
+struct txt_decimal
 {
-    if (ts->tok_pos >= ts->tok_count) {
-        return -THINGSET_ERR_DESERIALIZATION_FINISHED;
+    uint64_t significand;
+    int exponent;
+    bool negative;
+    /* non-zero digits were dropped because they did not fit into the significand */
+    bool inexact;
+};
+
+static inline int hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
     }
+    else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
 
-    const char *buf = ts->msg_payload + ts->tokens[ts->tok_pos].start;
-    size_t len = ts->tokens[ts->tok_pos].end - ts->tokens[ts->tok_pos].start;
+/* checks if another decimal digit can be appended to the significand without overflow */
+static inline bool significand_fits(uint64_t significand, int digit)
+{
+    return significand < UINT64_MAX / 10
+           || (significand == UINT64_MAX / 10 && digit <= UINT64_MAX % 10);
+}
 
-    if (ts->tokens[ts->tok_pos].type != JSMN_PRIMITIVE
-        && ts->tokens[ts->tok_pos].type != JSMN_STRING)
-    {
-        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+/**
+ * Parse a JSON number (additionally accepting hexadecimal integers with 0x prefix) from a buffer
+ * that is not null-terminated.
+ *
+ * @returns 0 for success or negative ThingSet response code if the buffer does not contain a
+ *          valid number
+ */
+static int parse_decimal(const char *buf, size_t len, struct txt_decimal *dec)
+{
+    const char *end = buf + len;
+    int num_digits = 0;
+
+    dec->significand = 0;
+    dec->exponent = 0;
+    dec->negative = false;
+    dec->inexact = false;
+
+    if (buf < end && (*buf == '-' || *buf == '+')) {
+        dec->negative = *buf == '-';
+        buf++;
     }
 
-    errno = 0;
-    switch (type) {
-        case THINGSET_TYPE_F32:
-            *data.f32 = strtod(buf, NULL);
-            break;
-#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
-        case THINGSET_TYPE_DECFRAC: {
-            float tmp = strtod(buf, NULL);
-            /* negative decimals and positive exponent */
-            for (int16_t i = 0; i < -detail; i++) {
-                tmp /= 10.0F;
-            }
-            /* positive decimals and negative exponent */
-            for (int16_t i = 0; i > -detail; i--) {
-                tmp *= 10.0F;
+    if (end - buf > 2 && buf[0] == '0' && (buf[1] == 'x' || buf[1] == 'X')) {
+        buf += 2;
+        for (; buf < end && hex_digit_value(*buf) >= 0; buf++, num_digits++) {
+            if (dec->significand > UINT64_MAX >> 4) {
+                return -THINGSET_ERR_UNSUPPORTED_FORMAT;
             }
-            *data.decfrac = (int32_t)tmp;
-            break;
+            dec->significand = (dec->significand << 4) | hex_digit_value(*buf);
         }
-#endif
-#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
-        case THINGSET_TYPE_U64:
-            *data.u64 = strtoull(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_I64:
-            *data.i64 = strtoll(buf, NULL, 0);
-            break;
-#endif
-        case THINGSET_TYPE_U32:
-            *data.u32 = strtoul(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_I32:
-            *data.i32 = strtol(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_U16:
-            *data.u16 = strtoul(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_I16:
-            *data.i16 = strtol(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_U8:
-            *data.u8 = strtoul(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_I8:
-            *data.i8 = strtol(buf, NULL, 0);
-            break;
-        case THINGSET_TYPE_BOOL:
-            if (buf[0] == 't' || buf[0] == '1') {
-                *data.b = true;
-            }
-            else if (buf[0] == 'f' || buf[0] == '0') {
-                *data.b = false;
+        return (num_digits > 0 && buf == end) ? 0 : -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    for (; buf < end && *buf >= '0' && *buf <= '9'; buf++, num_digits++) {
+        if (significand_fits(dec->significand, *buf - '0')) {
+            dec->significand = dec->significand * 10 + (*buf - '0');
+        }
+        else {
+            dec->exponent++;
+            dec->inexact |= *buf != '0';
+        }
+    }
+
+    if (buf < end && *buf == '.') {
+        buf++;
+        for (; buf < end && *buf >= '0' && *buf <= '9'; buf++, num_digits++) {
+            if (significand_fits(dec->significand, *buf - '0')) {
+                dec->significand = dec->significand * 10 + (*buf - '0');
+                dec->exponent--;
             }
             else {
-                return -THINGSET_ERR_UNSUPPORTED_FORMAT;
-            }
-            break;
-        case THINGSET_TYPE_STRING:
-            if (ts->tokens[ts->tok_pos].type != JSMN_STRING || (unsigned int)detail <= len) {
-                return -THINGSET_ERR_REQUEST_TOO_LARGE;
+                dec->inexact |= *buf != '0';
             }
-            if (!check_only) {
-#if CONFIG_THINGSET_JSON_STRING_ESCAPING
-                size_t data_pos = 0;
-                for (int pos = 0; pos < len; pos++) {
-                    if (buf[pos] == '\\') {
-                        pos++;
+        }
+    }
+
+    if (num_digits == 0) {
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    if (buf < end && (*buf == 'e' || *buf == 'E')) {
+        bool exp_negative = false;
+        int exp_value = 0;
+        buf++;
+        if (buf < end && (*buf == '-' || *buf == '+')) {
+            exp_negative = *buf == '-';
+            buf++;
+        }
+        if (buf == end) {
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+        }
+        for (; buf < end && *buf >= '0' && *buf <= '9'; buf++) {
+            /* saturate, as larger exponents result in zero or overflow anyway */
+            if (exp_value < 10000) {
+                exp_value = exp_value * 10 + (*buf - '0');
+            }
+        }
+        dec->exponent += exp_negative ? -exp_value : exp_value;
+    }
+
+    return buf == end ? 0 : -THINGSET_ERR_UNSUPPORTED_FORMAT;
+}
+
+/**
+ * Convert a decimal to an integer (truncated towards zero) within the range
+ * [-max_negative, max_positive], stored as two's complement in a uint64_t.
+ */
+static int decimal_to_integer(const struct txt_decimal *dec, uint64_t max_positive,
+                              uint64_t max_negative, uint64_t *value)
+{
+    uint64_t magnitude = dec->significand;
+
+    if (dec->inexact && dec->exponent > 0) {
+        /* non-zero integer digits were dropped, so the value is definitely above UINT64_MAX */
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    for (int i = 0; i < dec->exponent && magnitude > 0; i++) {
+        if (magnitude > UINT64_MAX / 10) {
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+        }
+        magnitude *= 10;
+    }
+    for (int i = 0; i > dec->exponent && magnitude > 0; i--) {
+        magnitude /= 10;
+    }
+
+    if (magnitude > (dec->negative ? max_negative : max_positive)) {
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    *value = dec->negative ? 0U - magnitude : magnitude;
+    return 0;
+}
+
+/* number of 32-bit words of the big integers used for float conversion */
+#define BIGNUM_WORDS 8
+
+/* shift of the significand (up to 64 bits) used for division by powers of 5 */
+#define BIGNUM_DIVIDEND_SHIFT (BIGNUM_WORDS * 32 - 64 - 2)
+
+static void bignum_multiply(uint32_t *words, uint32_t factor)
+{
+    uint64_t carry = 0;
+
+    for (int i = 0; i < BIGNUM_WORDS; i++) {
+        uint64_t cur = (uint64_t)words[i] * factor + carry;
+        words[i] = (uint32_t)cur;
+        carry = cur >> 32;
+    }
+}
+
+/* returns true if the remainder is not zero */
+static bool bignum_divide(uint32_t *words, uint32_t divisor)
+{
+    uint64_t rem = 0;
+
+    for (int i = BIGNUM_WORDS - 1; i >= 0; i--) {
+        uint64_t cur = (rem << 32) | words[i];
+        words[i] = cur / divisor;
+        rem = cur % divisor;
+    }
+
+    return rem != 0;
+}
+
+/* position of the most significant set bit or -1 if zero */
+static int bignum_msb(const uint32_t *words)
+{
+    for (int i = BIGNUM_WORDS - 1; i >= 0; i--) {
+        if (words[i] != 0) {
+            return i * 32 + 31 - __builtin_clz(words[i]);
+        }
+    }
+
+    return -1;
+}
+
+/* returns 32 bits starting at bit pos and sets sticky if any bit below pos is set */
+static uint32_t bignum_bits(const uint32_t *words, int pos, bool *sticky)
+{
+    int word = pos / 32;
+    int bit = pos % 32;
+    uint64_t bits = words[word];
+
+    if (word + 1 < BIGNUM_WORDS) {
+        bits |= (uint64_t)words[word + 1] << 32;
+    }
+
+    for (int i = 0; i < word; i++) {
+        *sticky |= words[i] != 0;
+    }
+    *sticky |= (words[word] & ((1ULL << bit) - 1)) != 0;
+
+    return (uint32_t)(bits >> bit);
+}
+
+/**
+ * Convert a decimal to the nearest float (ties to even).
+ *
+ * The conversion is exact for up to 19 significant digits, using only integer arithmetics
+ * except for a fast path where a single float operation is correctly rounded.
+ */
+static int decimal_to_f32(const struct txt_decimal *dec, float *value)
+{
+    uint32_t words[BIGNUM_WORDS] = { 0 };
+    bool sticky = dec->inexact;
+    int bin_exp;
+    uint32_t bits;
+
+    if (dec->significand == 0) {
+        *value = dec->negative ? -0.0F : 0.0F;
+        return 0;
+    }
+
+    if (dec->significand < (1U << 24) && !dec->inexact && dec->exponent >= -9
+        && dec->exponent <= 9)
+    {
+        /* significand and power of 10 are exactly representable as float */
+        float pow10 = (float)pow10_u32[dec->exponent < 0 ? -dec->exponent : dec->exponent];
+        *value = dec->exponent < 0 ? (float)dec->significand / pow10
+                                   : (float)dec->significand * pow10;
+        if (dec->negative) {
+            *value = -*value;
+        }
+        return 0;
+    }
+
+    if (dec->exponent > 39) {
+        /* significand >= 1, so definitely above FLT_MAX */
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+    else if (dec->exponent < -65) {
+        /* significand < 2^64, so definitely below half of the smallest subnormal float */
+        *value = dec->negative ? -0.0F : 0.0F;
+        return 0;
+    }
+    else if (dec->exponent >= 0) {
+        /* integer multiplication is exact */
+        words[0] = (uint32_t)dec->significand;
+        words[1] = (uint32_t)(dec->significand >> 32);
+        for (int i = 0; i < dec->exponent; i++) {
+            bignum_multiply(words, 10);
+        }
+        bin_exp = 0;
+    }
+    else {
+        /* 10^-k = 5^-k * 2^-k, where the division by 5^k is done with a dividend shifted far
+         * enough to the left to keep sufficient significant bits in the quotient */
+        int k = -dec->exponent;
+        int word = BIGNUM_DIVIDEND_SHIFT / 32;
+        int bit = BIGNUM_DIVIDEND_SHIFT % 32;
+        words[word] = (uint32_t)(dec->significand << bit);
+        words[word + 1] = (uint32_t)(dec->significand >> (32 - bit));
+        words[word + 2] = (uint32_t)(dec->significand >> (64 - bit));
+        for (; k >= 13; k -= 13) {
+            sticky |= bignum_divide(words, 1220703125U); /* 5^13 */
+        }
+        if (k > 0) {
+            uint32_t pow5 = 1;
+            for (int i = 0; i < k; i++) {
+                pow5 *= 5;
+            }
+            sticky |= bignum_divide(words, pow5);
+        }
+        bin_exp = dec->exponent - BIGNUM_DIVIDEND_SHIFT;
+    }
+
+    /* value = words * 2^bin_exp, which has to be rounded to 24 bits (or less for subnormals) */
+    int msb = bignum_msb(words);
+    int lsb_exp = msb + bin_exp - 23;
+    if (lsb_exp < -149) {
+        lsb_exp = -149;
+    }
+
+    int shift = lsb_exp - bin_exp;
+    uint32_t mantissa;
+    if (shift > 0) {
+        uint32_t raw = bignum_bits(words, shift - 1, &sticky);
+        bool round = raw & 1;
+        mantissa = (raw >> 1) & 0xFFFFFF;
+        if (round && (sticky || (mantissa & 1))) {
+            mantissa++;
+            if (mantissa == (1U << 24)) {
+                mantissa >>= 1;
+                lsb_exp++;
+            }
+        }
+    }
+    else {
+        /* small integer, exactly representable */
+        mantissa = words[0] << -shift;
+    }
+
+    if (mantissa >= (1U << 23)) {
+        int biased_exp = lsb_exp + 150;
+        if (biased_exp >= 255) {
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+        }
+        bits = ((uint32_t)biased_exp << 23) | (mantissa & 0x7FFFFF);
+    }
+    else {
+        /* subnormal number */
+        bits = mantissa;
+    }
+
+    if (dec->negative) {
+        bits |= 1U << 31;
+    }
+
+    memcpy(value, &bits, sizeof(bits));
+    return 0;
+}
+
+int thingset_txt_parse_number(const char *buf, size_t len, union thingset_data_pointer data,
+                              int type, int detail)
+{
+    struct txt_decimal dec;
+    uint64_t value;
+    int err;
+
+    err = parse_decimal(buf, len, &dec);
+    if (err) {
+        return err;
+    }
+
+    switch (type) {
+        case THINGSET_TYPE_F32:
+            return decimal_to_f32(&dec, data.f32);
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC:
+            /* scale the decimal input directly, e.g. 1.23 with 2 decimals results in 123 */
+            dec.exponent += detail;
+            err = decimal_to_integer(&dec, INT32_MAX, (uint64_t)INT32_MAX + 1, &value);
+            if (err == 0) {
+                *data.decfrac = (int32_t)value;
+            }
+            break;
+#endif
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+            err = decimal_to_integer(&dec, UINT64_MAX, 0, &value);
+            if (err == 0) {
+                *data.u64 = value;
+            }
+            break;
+        case THINGSET_TYPE_I64:
+            err = decimal_to_integer(&dec, INT64_MAX, (uint64_t)INT64_MAX + 1, &value);
+            if (err == 0) {
+                *data.i64 = (int64_t)value;
+            }
+            break;
+#endif
+        case THINGSET_TYPE_U32:
+            err = decimal_to_integer(&dec, UINT32_MAX, 0, &value);
+            if (err == 0) {
+                *data.u32 = (uint32_t)value;
+            }
+            break;
+        case THINGSET_TYPE_I32:
+            err = decimal_to_integer(&dec, INT32_MAX, (uint64_t)INT32_MAX + 1, &value);
+            if (err == 0) {
+                *data.i32 = (int32_t)value;
+            }
+            break;
+        case THINGSET_TYPE_U16:
+            err = decimal_to_integer(&dec, UINT16_MAX, 0, &value);
+            if (err == 0) {
+                *data.u16 = (uint16_t)value;
+            }
+            break;
+        case THINGSET_TYPE_I16:
+            err = decimal_to_integer(&dec, INT16_MAX, (uint64_t)INT16_MAX + 1, &value);
+            if (err == 0) {
+                *data.i16 = (int16_t)value;
+            }
+            break;
+        case THINGSET_TYPE_U8:
+            err = decimal_to_integer(&dec, UINT8_MAX, 0, &value);
+            if (err == 0) {
+                *data.u8 = (uint8_t)value;
+            }
+            break;
+        case THINGSET_TYPE_I8:
+            err = decimal_to_integer(&dec, INT8_MAX, (uint64_t)INT8_MAX + 1, &value);
+            if (err == 0) {
+                *data.i8 = (int8_t)value;
+            }
+            break;
+        default:
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    return err;
+}
+
+static int txt_deserialize_simple_value(struct thingset_context *ts,
+                                        union thingset_data_pointer data, int type, int detail,
+                                        bool check_only)
+{
+    if (ts->tok_pos >= ts->tok_count) {
+        return -THINGSET_ERR_DESERIALIZATION_FINISHED;
+    }
+
+    const char *buf = ts->msg_payload + ts->tokens[ts->tok_pos].start;
+    size_t len = ts->tokens[ts->tok_pos].end - ts->tokens[ts->tok_pos].start;
+
+    if (ts->tokens[ts->tok_pos].type != JSMN_PRIMITIVE
+        && ts->tokens[ts->tok_pos].type != JSMN_STRING)
+    {
+        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    switch (type) {
+        case THINGSET_TYPE_F32:
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC:
+#endif
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+        case THINGSET_TYPE_I64:
+#endif
+        case THINGSET_TYPE_U32:
+        case THINGSET_TYPE_I32:
+        case THINGSET_TYPE_U16:
+        case THINGSET_TYPE_I16:
+        case THINGSET_TYPE_U8:
+        case THINGSET_TYPE_I8: {
+            int err = thingset_txt_parse_number(buf, len, data, type, detail);
+            if (err) {
+                return err;
+            }
+            break;
+        }
+        case THINGSET_TYPE_BOOL:
+            if (buf[0] == 't' || buf[0] == '1') {
+                *data.b = true;
+            }
+            else if (buf[0] == 'f' || buf[0] == '0') {
+                *data.b = false;
+            }
+            else {
+                return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+            }
+            break;
+        case THINGSET_TYPE_STRING:
+            if (ts->tokens[ts->tok_pos].type != JSMN_STRING || (unsigned int)detail <= len) {
+                return -THINGSET_ERR_REQUEST_TOO_LARGE;
+            }
+            if (!check_only) {
+#if CONFIG_THINGSET_JSON_STRING_ESCAPING
+                size_t data_pos = 0;
+                for (int pos = 0; pos < len; pos++) {
+                    if (buf[pos] == '\\') {
+                        pos++;
                         switch (buf[pos]) {
                             case '"':
                             case '/':
@@ -639,10 +1439,6 @@ static int txt_deserialize_simple_value(struct thingset_context *ts,
             return -THINGSET_ERR_UNSUPPORTED_FORMAT;
     }
 
-    if (errno == ERANGE) {
-        return -THINGSET_ERR_UNSUPPORTED_FORMAT;
-    }
-
     ts->tok_pos++;
     return 0;
 }
@@ -693,63 +1489,261 @@ int thingset_txt_desire(struct thingset_context *ts)
 }
 
 /* currently only supporting nesting of depth 2 (parent and grandparent != 0) */
+/**
+ * Close the objects of previous subset members and open the parent (and grandparent) objects of
+ * the given subset member if required.
+ *
+ * @returns 0 for success or negative ThingSet reponse code in case of error
+ */
+static int txt_serialize_subset_parents(struct thingset_context *ts,
+                                        const struct thingset_data_object *object,
+                                        struct thingset_data_object *ancestors[2], int *depth)
+{
+    const uint16_t parent_id = object->parent_id;
+
+    struct thingset_data_object *parent = NULL;
+    if (*depth > 0 && parent_id == ancestors[*depth - 1]->id) {
+        /* same parent as previous item */
+        parent = ancestors[*depth - 1];
+    }
+    else if (parent_id != 0) {
+        /* parent needs to be searched in the object database */
+        parent = thingset_get_object_by_id(ts, parent_id);
+    }
+
+    /* close object if previous object had different parent or grandparent */
+    if (*depth > 0 && parent_id != ancestors[*depth - 1]->id
+        && ((parent != NULL && parent->parent_id != ancestors[*depth - 1]->id)
+            || parent_id == 0)) /* return to root */
+    {
+        ts->rsp[ts->rsp_pos - 1] = '}'; /* overwrite comma */
+        ts->rsp[ts->rsp_pos++] = ',';
+        (*depth)--;
+    }
+
+    if (*depth == 0 && parent != NULL) {
+        if (parent->parent_id != 0) {
+            struct thingset_data_object *grandparent =
+                thingset_get_object_by_id(ts, parent->parent_id);
+            if (grandparent != NULL) {
+                if (txt_serialize_key(ts, grandparent) != 0 || ts->rsp_pos >= ts->rsp_size) {
+                    return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+                }
+                ts->rsp[ts->rsp_pos++] = '{';
+                ancestors[(*depth)++] = grandparent;
+            }
+        }
+        if (txt_serialize_key(ts, parent) != 0 || ts->rsp_pos >= ts->rsp_size) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        ts->rsp[ts->rsp_pos++] = '{';
+        ancestors[(*depth)++] = parent;
+    }
+    else if (*depth > 0 && parent_id != ancestors[*depth - 1]->id) {
+        if (parent != NULL) {
+            if (txt_serialize_key(ts, parent) != 0 || ts->rsp_pos >= ts->rsp_size) {
+                return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+            }
+            ts->rsp[ts->rsp_pos++] = '{';
+            ancestors[(*depth)++] = parent;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Serialize a subset member including the required parent objects, leaving space for the
+ * closing brackets of all open objects.
+ *
+ * @returns 0 for success or negative ThingSet reponse code in case of error
+ */
+static int txt_serialize_subset_member(struct thingset_context *ts,
+                                       const struct thingset_data_object *object,
+                                       struct thingset_data_object *ancestors[2], int *depth)
+{
+    if (txt_serialize_subset_parents(ts, object, ancestors, depth) != 0) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    int err = ts->api->serialize_key_value(ts, object);
+    if (err != 0) {
+        return err;
+    }
+
+    /* the trailing comma is moved behind the brackets */
+    return ts->rsp_pos + *depth + 1 <= ts->rsp_size ? 0 : -THINGSET_ERR_RESPONSE_TOO_LARGE;
+}
+
+/**
+ * Close all objects opened for the subset members, including the outer map.
+ */
+static void txt_serialize_subsets_end(struct thingset_context *ts, int depth)
+{
+    ts->rsp_pos--; /* overwrite internal comma */
+
+    while (depth >= 0) {
+        ts->rsp[ts->rsp_pos++] = '}';
+        depth--;
+    }
+
+    ts->rsp[ts->rsp_pos++] = ',';
+}
+
 static int txt_serialize_subsets(struct thingset_context *ts, uint16_t subsets)
 {
-    struct thingset_data_object *ancestors[2];
+    struct thingset_data_object *ancestors[2] = { NULL, NULL };
     int depth = 0;
+    int err;
 
+    if (ts->rsp_pos >= ts->rsp_size) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
     ts->rsp[ts->rsp_pos++] = '{';
 
-    for (unsigned int i = 0; i < ts->num_objects; i++) {
-        if (ts->data_objects[i].subsets & subsets) {
-            const uint16_t parent_id = ts->data_objects[i].parent_id;
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+        size_t pos = ts->rsp_pos;
+        char last = ts->rsp[pos - 1];
+        struct thingset_data_object *prev_ancestors[2] = { ancestors[0], ancestors[1] };
+        int prev_depth = depth;
+#endif
+
+        err = txt_serialize_subset_member(ts, &ts->data_objects[i], ancestors, &depth);
 
-            struct thingset_data_object *parent = NULL;
-            if (depth > 0 && parent_id == ancestors[depth - 1]->id) {
-                /* same parent as previous item */
-                parent = ancestors[depth - 1];
-            }
-            else if (parent_id != 0) {
-                /* parent needs to be searched in the object database */
-                parent = thingset_get_object_by_id(ts, parent_id);
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+        if (err == -THINGSET_ERR_RESPONSE_TOO_LARGE && ts->sink != NULL && pos > 1) {
+            /* restore the state before this member and pass the preceding data to the sink,
+             * except for the last character (a comma which may be replaced by a bracket) */
+            ts->rsp[pos - 1] = last;
+            ancestors[0] = prev_ancestors[0];
+            ancestors[1] = prev_ancestors[1];
+            depth = prev_depth;
+
+            err = thingset_sink_flush(ts, pos, 1);
+            if (err == 0) {
+                ts->rsp_pos = 1;
+                err = txt_serialize_subset_member(ts, &ts->data_objects[i], ancestors, &depth);
             }
+        }
+#endif
+
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    txt_serialize_subsets_end(ts, depth);
+
+    return 0;
+}
+
+int thingset_txt_export_subsets_progressively(struct thingset_context *ts, uint16_t subsets,
+                                              unsigned int *index, size_t *len)
+{
+    if (ts->rsp_size < 2) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    if (*index == 0) {
+        ts->rsp[0] = '{';
+        ts->export_ancestors[0] = NULL;
+        ts->export_ancestors[1] = NULL;
+        ts->export_depth = 0;
+    }
+    else {
+        /* comma withheld from the previous chunk, as it may be replaced by a bracket */
+        ts->rsp[0] = ',';
+    }
+    ts->rsp_pos = 1;
+
+    for (*index = thingset_next_subset_member(ts, subsets, *index); *index < ts->num_objects;
+         *index = thingset_next_subset_member(ts, subsets, *index + 1))
+    {
+        size_t pos = ts->rsp_pos;
+        struct thingset_data_object *ancestors[2] = { ts->export_ancestors[0],
+                                                      ts->export_ancestors[1] };
+        int depth = ts->export_depth;
+
+        int err = txt_serialize_subset_member(ts, &ts->data_objects[*index], ancestors, &depth);
+        if (err == -THINGSET_ERR_RESPONSE_TOO_LARGE && pos > 1) {
+            /* continue with this member in the next chunk, keeping the objects opened before */
+            *len = pos - 1;
+            return 1;
+        }
+        else if (err != 0) {
+            /* this element alone is too large to fit the buffer */
+            return err;
+        }
+
+        ts->export_ancestors[0] = ancestors[0];
+        ts->export_ancestors[1] = ancestors[1];
+        ts->export_depth = depth;
+    }
+
+    txt_serialize_subsets_end(ts, ts->export_depth);
+    ts->api->serialize_finish(ts);
+    *len = ts->rsp_pos;
+
+    return 0;
+}
+
+static int txt_serialize_report_header(struct thingset_context *ts, const char *path)
+{
+    ts->rsp_pos = snprintf(ts->rsp, ts->rsp_size, "#%s ", path);
+    if (ts->rsp_pos < 0 || ts->rsp_pos > ts->rsp_size) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+    else {
+        /* the space may have been replaced by the null-termination */
+        ts->rsp[ts->rsp_pos - 1] = ' ';
+        return 0;
+    }
+}
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+static int txt_prepare_report_template(struct thingset_context *ts,
+                                       struct thingset_report_template *tmpl, const char *path)
+{
+    struct thingset_data_object *ancestors[2];
+    int depth = 0;
+
+    if (path != NULL) {
+        if (txt_serialize_report_header(ts, path) != 0) {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        tmpl->header_len = ts->rsp_pos;
+    }
+    else {
+        /* keep the previously serialized header */
+        ts->rsp_pos = tmpl->header_len;
+    }
+
+    if (ts->rsp_pos >= ts->rsp_size - 2) {
+        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+    }
+
+    ts->rsp[ts->rsp_pos++] = '{';
 
-            /* close object if previous object had different parent or grandparent */
-            if (depth > 0 && parent_id != ancestors[depth - 1]->id
-                && ((parent != NULL && parent->parent_id != ancestors[depth - 1]->id)
-                    || parent_id == 0)) /* return to root */
-            {
-                ts->rsp[ts->rsp_pos - 1] = '}'; /* overwrite comma */
-                ts->rsp[ts->rsp_pos++] = ',';
-                depth--;
-            }
+    for (unsigned int i = 0; i < tmpl->num_members; i++) {
+        const struct thingset_data_object *object = &ts->data_objects[tmpl->members[i]];
 
-            if (depth == 0 && parent != NULL) {
-                if (parent->parent_id != 0) {
-                    struct thingset_data_object *grandparent =
-                        thingset_get_object_by_id(ts, parent->parent_id);
-                    if (grandparent != NULL) {
-                        ts->rsp_pos += snprintf(ts->rsp + ts->rsp_pos, ts->rsp_size - ts->rsp_pos,
-                                                "\"%s\":{", grandparent->name);
-                        ancestors[depth++] = grandparent;
-                    }
-                }
-                ts->rsp_pos += snprintf(ts->rsp + ts->rsp_pos, ts->rsp_size - ts->rsp_pos,
-                                        "\"%s\":{", parent->name);
-                ancestors[depth++] = parent;
-            }
-            else if (depth > 0 && parent_id != ancestors[depth - 1]->id) {
-                if (parent != NULL) {
-                    ts->rsp_pos += snprintf(ts->rsp + ts->rsp_pos, ts->rsp_size - ts->rsp_pos,
-                                            "\"%s\":{", parent->name);
-                    ancestors[depth++] = parent;
-                }
-            }
-            ts->rsp_pos += ts->api->serialize_key_value(ts, &ts->data_objects[i]);
+        if (txt_serialize_subset_parents(ts, object, ancestors, &depth) != 0
+            || txt_serialize_key(ts, object) != 0)
+        {
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
         }
+        tmpl->segment_ends[i] = ts->rsp_pos;
+
+        /* comma appended to the value, which is part of the next segment, as it may have to be
+         * replaced by a closing bracket */
         if (ts->rsp_pos >= ts->rsp_size - 1 - depth) {
             return -THINGSET_ERR_RESPONSE_TOO_LARGE;
         }
+        ts->rsp[ts->rsp_pos++] = ',';
     }
 
     ts->rsp_pos--; /* overwrite internal comma */
@@ -761,20 +1755,40 @@ static int txt_serialize_subsets(struct thingset_context *ts, uint16_t subsets)
 
     ts->rsp[ts->rsp_pos++] = ',';
 
+    tmpl->segment_ends[tmpl->num_members] = ts->rsp_pos;
+
     return 0;
 }
 
-static int txt_serialize_report_header(struct thingset_context *ts, const char *path)
+static int txt_serialize_report_template(struct thingset_context *ts,
+                                         const struct thingset_report_template *tmpl)
 {
-    ts->rsp_pos = snprintf(ts->rsp, ts->rsp_size, "#%s ", path);
-    if (ts->rsp_pos < 0 || ts->rsp_pos > ts->rsp_size) {
-        return -THINGSET_ERR_RESPONSE_TOO_LARGE;
-    }
-    else {
-        return 0;
+    size_t start = 0;
+
+    for (unsigned int i = 0; i <= tmpl->num_members; i++) {
+        size_t len = tmpl->segment_ends[i] - start;
+        if (len > ts->rsp_size - ts->rsp_pos) {
+            ts->rsp_pos = 0;
+            return -THINGSET_ERR_RESPONSE_TOO_LARGE;
+        }
+        memcpy(ts->rsp + ts->rsp_pos, tmpl->data + start, len);
+        ts->rsp_pos += len;
+        start = tmpl->segment_ends[i];
+
+        if (i < tmpl->num_members) {
+            int err = txt_serialize_value(ts, &ts->data_objects[tmpl->members[i]]);
+            if (err != 0) {
+                return err;
+            }
+            ts->rsp_pos--; /* comma is contained in the next segment */
+        }
     }
+
+    return 0;
 }
 
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
 static void txt_deserialize_payload_reset(struct thingset_context *ts)
 {
     ts->msg_pos = ts->msg_payload - ts->msg;
@@ -898,6 +1912,281 @@ static int txt_deserialize_finish(struct thingset_context *ts)
     return ts->tok_count == ts->tok_pos ? 0 : -THINGSET_ERR_BAD_REQUEST;
 }
 
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+/**
+ * @returns Maximum length of a simple value including the trailing comma or 0 if the type is not
+ *          a simple value
+ */
+static size_t txt_simple_value_size_max(union thingset_data_pointer data, int type, int detail)
+{
+    switch (type) {
+#if CONFIG_THINGSET_64BIT_TYPES_SUPPORT
+        case THINGSET_TYPE_U64:
+        case THINGSET_TYPE_I64:
+            return 20 + 1;
+#endif
+        case THINGSET_TYPE_U32:
+            return 10 + 1;
+        case THINGSET_TYPE_I32:
+            return 11 + 1;
+        case THINGSET_TYPE_U16:
+            return 5 + 1;
+        case THINGSET_TYPE_I16:
+            return 6 + 1;
+        case THINGSET_TYPE_U8:
+            return 3 + 1;
+        case THINGSET_TYPE_I8:
+            return 4 + 1;
+        case THINGSET_TYPE_F32: {
+            int decimals =
+                (detail < 0 || detail > THINGSET_DECIMALS_MAX) ? THINGSET_DECIMALS_MAX : detail;
+            /* sign and up to 39 integer digits (FLT_MAX) */
+            return 1 + 39 + (decimals > 0 ? 1 + decimals : 0) + 1;
+        }
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+        case THINGSET_TYPE_DECFRAC: {
+            /* the exponent is constant for each data object */
+            char buf[12];
+            return 11 + 1 + thingset_txt_format_i32(buf, sizeof(buf), -detail) + 1;
+        }
+#endif
+        case THINGSET_TYPE_BOOL:
+            return 5 + 1;
+        case THINGSET_TYPE_STRING: {
+            size_t len = detail > 0 ? detail - 1 : 0;
+            if (IS_ENABLED(CONFIG_THINGSET_JSON_STRING_ESCAPING)) {
+                len *= 2;
+            }
+            return len + 3;
+        }
+#if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
+        case THINGSET_TYPE_BYTES:
+            /* the base64 encoder requires space for an additional null-termination */
+            return 4 * ((data.bytes->max_bytes + 2) / 3) + 4;
+#endif
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @returns Length of a simple value with its current value including the trailing comma or 0 if
+ *          the type is not a simple value
+ */
+static size_t txt_simple_value_size(union thingset_data_pointer data, int type, int detail)
+{
+    /* sufficient for the maximum length of numbers (see txt_simple_value_size_max) */
+    char buf[64];
+    size_t len;
+
+    switch (type) {
+        case THINGSET_TYPE_STRING:
+#if CONFIG_THINGSET_JSON_STRING_ESCAPING
+            /* same escaping as in json_serialize_simple_value */
+            len = 0;
+            for (int pos = 0; pos < detail && data.str[pos] != '\0'; pos++) {
+                len += strchr("\\\"\b\f\n\r\t", data.str[pos]) != NULL ? 2 : 1;
+            }
+#else
+            len = strlen(data.str);
+#endif
+            return len + 3;
+#if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
+        case THINGSET_TYPE_BYTES:
+            return 4 * ((data.bytes->num_bytes + 2) / 3) + 3;
+#endif
+        default: {
+            int ret = json_serialize_simple_value(buf, sizeof(buf), data, type, detail);
+            return ret > 0 ? ret : 0;
+        }
+    }
+}
+
+static size_t txt_key_size(struct thingset_context *ts, const struct thingset_data_object *object)
+{
+    return thingset_get_name_length(ts, object) + 3;
+}
+
+static size_t txt_container_size(struct thingset_context *ts, size_t num_elements, bool max)
+{
+    /* brackets and trailing comma, as the comma of the last element is overwritten */
+    return max || num_elements == 0 ? 3 : 2;
+}
+
+static size_t txt_value_size(struct thingset_context *ts, const struct thingset_data_object *object,
+                             bool report, bool max)
+{
+    size_t len = max ? txt_simple_value_size_max(object->data, object->type, object->detail)
+                     : txt_simple_value_size(object->data, object->type, object->detail);
+    size_t num = 0;
+    unsigned int pos;
+
+    if (len > 0) {
+        return len;
+    }
+
+    switch (object->type) {
+        case THINGSET_TYPE_GROUP:
+            return 4 + 1;
+        case THINGSET_TYPE_RECORDS: {
+            struct thingset_records *records = object->data.records;
+            if (IS_ENABLED(CONFIG_THINGSET_REPORT_RECORD_SERIALIZATION) && report) {
+                if (max) {
+                    return txt_container_size(ts, records->max_records, max)
+                           + records->max_records
+                                 * thingset_common_record_size(ts, object, 0, report, max);
+                }
+                for (unsigned int i = 0; i < records->num_records; i++) {
+                    len += thingset_common_record_size(ts, object, i, report, max);
+                }
+                return txt_container_size(ts, records->num_records, max) + len;
+            }
+            if (max) {
+                return 5 + 1;
+            }
+            char buf[12];
+            return thingset_txt_format_u32(buf, sizeof(buf), records->num_records) + 1;
+        }
+        case THINGSET_TYPE_FN_VOID:
+        case THINGSET_TYPE_FN_I32:
+            for (struct thingset_data_object *param = thingset_get_first_child(ts, object, &pos);
+                 param != NULL; param = thingset_get_next_child(ts, object, &pos))
+            {
+                len += thingset_get_name_length(ts, param) + 3;
+                num++;
+            }
+            return txt_container_size(ts, num, max) + len;
+        case THINGSET_TYPE_SUBSET:
+            for (unsigned int i = thingset_next_subset_member(ts, object->data.subset, 0);
+                 i < ts->num_objects;
+                 i = thingset_next_subset_member(ts, object->data.subset, i + 1))
+            {
+                len += thingset_get_path_length(ts, &ts->data_objects[i]) + 3;
+                num++;
+            }
+            return txt_container_size(ts, num, max) + len;
+        case THINGSET_TYPE_ARRAY: {
+            struct thingset_array *array = object->data.array;
+            if (array == NULL) {
+                return 0;
+            }
+            if (max) {
+                return txt_container_size(ts, array->max_elements, max)
+                       + array->max_elements
+                             * txt_simple_value_size_max(array->elements, array->element_type,
+                                                         array->decimals);
+            }
+            size_t type_size = thingset_type_size(array->element_type);
+            for (int i = 0; i < array->num_elements; i++) {
+                /* using uint8_t pointer for byte-wise pointer arithmetics */
+                union thingset_data_pointer data = { .u8 = array->elements.u8 + i * type_size };
+                len += txt_simple_value_size(data, array->element_type, array->decimals);
+            }
+            return txt_container_size(ts, array->num_elements, max) + len;
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Determine the length of the parent objects opened or closed before the given subset member,
+ * updating the ancestors in the same way as txt_serialize_subset_parents.
+ */
+static size_t txt_subset_parents_size(struct thingset_context *ts,
+                                      const struct thingset_data_object *object,
+                                      struct thingset_data_object *ancestors[2], int *depth)
+{
+    const uint16_t parent_id = object->parent_id;
+    size_t len = 0;
+
+    struct thingset_data_object *parent = NULL;
+    if (*depth > 0 && parent_id == ancestors[*depth - 1]->id) {
+        parent = ancestors[*depth - 1];
+    }
+    else if (parent_id != 0) {
+        parent = thingset_get_object_by_id(ts, parent_id);
+    }
+
+    if (*depth > 0 && parent_id != ancestors[*depth - 1]->id
+        && ((parent != NULL && parent->parent_id != ancestors[*depth - 1]->id)
+            || parent_id == 0))
+    {
+        /* closing bracket in addition to the comma */
+        len += 1;
+        (*depth)--;
+    }
+
+    if (*depth == 0 && parent != NULL) {
+        if (parent->parent_id != 0) {
+            struct thingset_data_object *grandparent =
+                thingset_get_object_by_id(ts, parent->parent_id);
+            if (grandparent != NULL) {
+                len += txt_key_size(ts, grandparent) + 1;
+                ancestors[(*depth)++] = grandparent;
+            }
+        }
+        len += txt_key_size(ts, parent) + 1;
+        ancestors[(*depth)++] = parent;
+    }
+    else if (*depth > 0 && parent_id != ancestors[*depth - 1]->id && parent != NULL) {
+        len += txt_key_size(ts, parent) + 1;
+        ancestors[(*depth)++] = parent;
+    }
+
+    return len;
+}
+
+static size_t txt_subsets_size(struct thingset_context *ts, uint16_t subsets, bool report,
+                               bool max)
+{
+    struct thingset_data_object *ancestors[2] = { NULL, NULL };
+    int depth = 0;
+    thingset_object_id_t prev_parent_id = 0;
+    size_t len = 1;
+
+    for (unsigned int i = thingset_next_subset_member(ts, subsets, 0); i < ts->num_objects;
+         i = thingset_next_subset_member(ts, subsets, i + 1))
+    {
+        const struct thingset_data_object *object = &ts->data_objects[i];
+
+        if (!max) {
+            len += txt_subset_parents_size(ts, object, ancestors, &depth);
+        }
+        else if (object->parent_id != 0 && object->parent_id != prev_parent_id) {
+            /* in the worst case, the parent and grandparent have to be opened again (see
+             * txt_serialize_subset_parents), each with key and both brackets */
+            struct thingset_data_object *parent =
+                thingset_get_object_by_id(ts, object->parent_id);
+            if (parent != NULL) {
+                len += txt_key_size(ts, parent) + 2;
+                if (parent->parent_id != 0) {
+                    struct thingset_data_object *grandparent =
+                        thingset_get_object_by_id(ts, parent->parent_id);
+                    if (grandparent != NULL) {
+                        len += txt_key_size(ts, grandparent) + 2;
+                    }
+                }
+            }
+        }
+        prev_parent_id = object->parent_id;
+
+        len += txt_key_size(ts, object) + txt_value_size(ts, object, report, max);
+    }
+
+    /* closing brackets of the open objects and the outer map replacing the last comma (see
+     * txt_serialize_subsets_end), followed by a comma */
+    return max ? len + 2 : len + depth + 1;
+}
+
+static size_t txt_report_header_size(struct thingset_context *ts, const char *path, bool max)
+{
+    return strlen(path) + 2;
+}
+
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
 static struct thingset_api txt_api = {
     .serialize_response = txt_serialize_response,
     .serialize_key = txt_serialize_name,
@@ -906,6 +2195,9 @@ static struct thingset_api txt_api = {
     .serialize_path = txt_serialize_path,
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
     .serialize_metadata = txt_serialize_metadata,
+#endif
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+    .serialize_path_key = txt_serialize_path_key,
 #endif
     .serialize_map_start = txt_serialize_map_start,
     .serialize_map_end = txt_serialize_map_end,
@@ -913,7 +2205,22 @@ static struct thingset_api txt_api = {
     .serialize_list_end = txt_serialize_list_end,
     .serialize_subsets = txt_serialize_subsets,
     .serialize_report_header = txt_serialize_report_header,
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+    .prepare_report_template = txt_prepare_report_template,
+    .serialize_report_template = txt_serialize_report_template,
+#endif
     .serialize_finish = txt_serialize_finish,
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    .serialize_length = txt_serialize_length,
+    .serialize_truncate = txt_serialize_truncate,
+#endif
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+    .key_size = txt_key_size,
+    .value_size = txt_value_size,
+    .container_size = txt_container_size,
+    .subsets_size = txt_subsets_size,
+    .report_header_size = txt_report_header_size,
+#endif
     .deserialize_payload_reset = txt_deserialize_payload_reset,
     .deserialize_string = txt_deserialize_string,
     .deserialize_null = txt_deserialize_null,
@@ -975,6 +2282,11 @@ int thingset_txt_process(struct thingset_context *ts)
 
     ret = request_fn(ts);
 
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+    /* position of the next requested element (FETCH only) */
+    ts->cont_msg_pos = ts->tok_pos;
+#endif
+
 out:
     if (ts->msg[0] != THINGSET_TXT_DESIRE) {
         if (ts->rsp_pos > 0) {
@@ -987,3 +2299,221 @@ out:
         return ret;
     }
 }
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+int thingset_txt_process_continue(struct thingset_context *ts)
+{
+    int err;
+
+    thingset_txt_setup(ts);
+
+    /* the request is parsed again, as the context may have been used otherwise in the meantime */
+    err = txt_parse_endpoint(ts);
+    if (err == 0) {
+        err = txt_parse_payload(ts);
+    }
+
+    if (err == 0) {
+        ts->tok_pos = ts->cont_msg_pos;
+
+        /* comma withheld at the end of the previous piece */
+        ts->rsp[ts->rsp_pos++] = ',';
+
+        err = thingset_common_continue(ts, true);
+    }
+
+    if (err == -THINGSET_ERR_RESPONSE_CONTINUED) {
+        ts->cont_msg_pos = ts->tok_pos;
+    }
+    else {
+        ts->cont_type = THINGSET_CONT_NONE;
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    /* remove the trailing comma and terminate string */
+    txt_serialize_finish(ts);
+
+    return ts->rsp_pos;
+}
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+static size_t txt_skip_whitespace(const char *buf, size_t pos, size_t len)
+{
+    while (pos < len && (buf[pos] == ' ' || buf[pos] == '\t' || buf[pos] == '\r'
+                         || buf[pos] == '\n'))
+    {
+        pos++;
+    }
+
+    return pos;
+}
+
+/**
+ * Determine the length of the JSON value (or key) at the beginning of the buffer.
+ *
+ * @returns Length of the value, 0 if more data is required to find its end or negative ThingSet
+ *          response code in case of error
+ */
+static int txt_scan_value(const char *buf, size_t len, bool eof)
+{
+    bool in_string = false;
+    int depth = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (in_string) {
+            if (buf[i] == '\\') {
+                i++; /* skip escaped character */
+            }
+            else if (buf[i] == '"') {
+                in_string = false;
+                if (depth == 0) {
+                    return i + 1;
+                }
+            }
+            continue;
+        }
+
+        switch (buf[i]) {
+            case '"':
+                in_string = true;
+                break;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (depth == 0) {
+                    /* end of enclosing map terminates a primitive */
+                    return i > 0 ? i : -THINGSET_ERR_BAD_REQUEST;
+                }
+                if (--depth == 0) {
+                    return i + 1;
+                }
+                break;
+            case ',':
+            case ':':
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                if (depth == 0) {
+                    return i > 0 ? i : -THINGSET_ERR_BAD_REQUEST;
+                }
+                break;
+        }
+    }
+
+    /* a primitive is also terminated by the end of the data */
+    return eof && !in_string && depth == 0 ? len : 0;
+}
+
+/**
+ * Import the next element (map start or end, separator or key-value pair) from the window
+ * buffer of the source.
+ *
+ * @returns 0 if the element was imported, 1 if more data is required,
+ *          -THINGSET_ERR_DESERIALIZATION_FINISHED after the end of the top-level map or negative
+ *          ThingSet response code in case of error
+ */
+static int txt_import_source_element(struct thingset_context *ts,
+                                     const struct thingset_data_object **parents, int *depth,
+                                     size_t *pos, uint8_t auth_flags)
+{
+    const char *buf = (const char *)ts->source->buf;
+    size_t len = ts->source_len;
+    size_t i = txt_skip_whitespace(buf, *pos, len);
+
+    if (i == len) {
+        return 1;
+    }
+
+    if (*depth < 0) {
+        if (buf[i] != '{') {
+            return -THINGSET_ERR_UNSUPPORTED_FORMAT;
+        }
+        parents[++(*depth)] = NULL;
+        *pos = i + 1;
+        return 0;
+    }
+    else if (buf[i] == ',') {
+        *pos = i + 1;
+        return 0;
+    }
+    else if (buf[i] == '}') {
+        *pos = i + 1;
+        return --(*depth) < 0 ? -THINGSET_ERR_DESERIALIZATION_FINISHED : 0;
+    }
+    else if (buf[i] != '"') {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+
+    int key_len = txt_scan_value(buf + i, len - i, ts->source_eof);
+    if (key_len <= 0) {
+        return key_len == 0 ? 1 : key_len;
+    }
+    const char *key = buf + i + 1;
+
+    i = txt_skip_whitespace(buf, i + key_len, len);
+    if (i < len && buf[i] != ':') {
+        return -THINGSET_ERR_BAD_REQUEST;
+    }
+    i = txt_skip_whitespace(buf, i + 1, len);
+    if (i >= len) {
+        return 1;
+    }
+
+    const struct thingset_data_object *object =
+        thingset_source_lookup(ts, parents[*depth], key, key_len - 2);
+
+    if (buf[i] == '{' && object != NULL && object->type == THINGSET_TYPE_GROUP) {
+        if (*depth + 1 >= CONFIG_THINGSET_IMPORT_SOURCE_MAX_DEPTH) {
+            return -THINGSET_ERR_REQUEST_TOO_LARGE;
+        }
+        parents[++(*depth)] = object;
+        *pos = i + 1;
+        return 0;
+    }
+
+    int value_len = txt_scan_value(buf + i, len - i, ts->source_eof);
+    if (value_len <= 0) {
+        return value_len == 0 ? 1 : value_len;
+    }
+
+    if (object != NULL) {
+        ts->msg = buf + i;
+        ts->msg_len = value_len;
+        ts->msg_payload = ts->msg;
+        txt_deserialize_payload_reset(ts);
+        thingset_source_import_value(ts, object, auth_flags);
+    }
+
+    *pos = i + value_len;
+    return 0;
+}
+
+int thingset_txt_import_source(struct thingset_context *ts, uint8_t auth_flags)
+{
+    const struct thingset_data_object *parents[CONFIG_THINGSET_IMPORT_SOURCE_MAX_DEPTH];
+    int depth = -1;
+    size_t pos = 0;
+    int ret;
+
+    while ((ret = txt_import_source_element(ts, parents, &depth, &pos, auth_flags)) >= 0) {
+        if (ret == 1) {
+            ret = thingset_source_refill(ts, pos);
+            if (ret != 0) {
+                return ret;
+            }
+            pos = 0;
+        }
+    }
+
+    return ret == -THINGSET_ERR_DESERIALIZATION_FINISHED ? 0 : ret;
+}
+
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "objects.h"
+
+static struct thingset_context ts;
+
+static uint8_t buf[NUM_OBJECTS_MAX / OBJECTS_PER_GROUP * 8];
+
+static void benchmark_export_subsets(size_t num)
+{
+    uint32_t start;
+    uint32_t cycles;
+    int len;
+
+    generate_objects(num);
+    thingset_init(&ts, objects, num);
+
+    /* first export builds the indices if CONFIG_THINGSET_INDEX_LAZY_BUILD is enabled */
+    len = thingset_export_subsets(&ts, buf, sizeof(buf), SUBSET_BENCHMARK, THINGSET_BIN_IDS_VALUES);
+    zassert_true(len > 0);
+
+    start = k_cycle_get_32();
+    len = thingset_export_subsets(&ts, buf, sizeof(buf), SUBSET_BENCHMARK, THINGSET_BIN_IDS_VALUES);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_export_subsets with %zu objects: %u cycles (%u us), %d bytes\n", num,
+             cycles, k_cyc_to_us_floor32(cycles), len);
+
+    zassert_true(len > 0);
+}
+
+ZTEST(thingset_benchmark_export, test_export_subsets_1k)
+{
+    benchmark_export_subsets(1000);
+}
+
+ZTEST(thingset_benchmark_export, test_export_subsets_10k)
+{
+    benchmark_export_subsets(10000);
+}
+
+ZTEST_SUITE(thingset_benchmark_export, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "../../src/thingset_internal.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_VALUES 1000
+
+ZTEST(thingset_benchmark_format, test_format_i32)
+{
+    char buf[16];
+    uint32_t start;
+    uint32_t cycles_snprintf;
+    uint32_t cycles_format;
+    int32_t value;
+
+    value = -NUM_VALUES / 2 * 12345;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value += 12345) {
+        snprintf(buf, sizeof(buf), "%" PRIi32 ",", value);
+    }
+    cycles_snprintf = k_cycle_get_32() - start;
+
+    value = -NUM_VALUES / 2 * 12345;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value += 12345) {
+        thingset_txt_format_i32(buf, sizeof(buf), value);
+    }
+    cycles_format = k_cycle_get_32() - start;
+
+    TC_PRINT("format %d i32 values: snprintf %u cycles, digit pairs %u cycles\n", NUM_VALUES,
+             cycles_snprintf, cycles_format);
+}
+
+ZTEST(thingset_benchmark_format, test_format_u64)
+{
+    char buf[24];
+    uint32_t start;
+    uint32_t cycles_snprintf;
+    uint32_t cycles_format;
+    uint64_t value;
+
+    value = 1;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value = value * 3 + 7) {
+        snprintf(buf, sizeof(buf), "%" PRIu64 ",", value);
+    }
+    cycles_snprintf = k_cycle_get_32() - start;
+
+    value = 1;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value = value * 3 + 7) {
+        thingset_txt_format_u64(buf, sizeof(buf), value);
+    }
+    cycles_format = k_cycle_get_32() - start;
+
+    TC_PRINT("format %d u64 values: snprintf %u cycles, digit pairs %u cycles\n", NUM_VALUES,
+             cycles_snprintf, cycles_format);
+}
+
+ZTEST(thingset_benchmark_format, test_format_f32)
+{
+    char buf[64];
+    uint32_t start;
+    uint32_t cycles_snprintf;
+    uint32_t cycles_format;
+    float value;
+
+    value = -1000.0F;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value += 1.234F) {
+        snprintf(buf, sizeof(buf), "%.*f,", 2, (double)value);
+    }
+    cycles_snprintf = k_cycle_get_32() - start;
+
+    value = -1000.0F;
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++, value += 1.234F) {
+        thingset_txt_format_f32(buf, sizeof(buf), value, 2);
+    }
+    cycles_format = k_cycle_get_32() - start;
+
+    TC_PRINT("format %d f32 values: snprintf %u cycles, fixed decimals %u cycles\n", NUM_VALUES,
+             cycles_snprintf, cycles_format);
+}
+
+ZTEST_SUITE(thingset_benchmark_format, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "../../src/thingset_internal.h"
+
+#include "objects.h"
+
+static struct thingset_context ts;
+
+static void benchmark_init(size_t num)
+{
+    uint32_t start;
+    uint32_t cycles;
+
+    generate_objects(num);
+
+    start = k_cycle_get_32();
+    thingset_init(&ts, objects, num);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_init with %zu objects: %u cycles (%u us)\n", num, cycles,
+             k_cyc_to_us_floor32(cycles));
+
+    /* linear search if CONFIG_THINGSET_INDEX_LAZY_BUILD is enabled (indices not built yet) */
+    start = k_cycle_get_32();
+    struct thingset_data_object *obj = thingset_get_object_by_id(&ts, 0x1000 + num - 1);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("first lookup with %zu objects: %u cycles (%u us)\n", num, cycles,
+             k_cyc_to_us_floor32(cycles));
+
+    zassert_equal(ts.num_objects, num);
+    zassert_equal(obj, &objects[num - 1]);
+}
+
+ZTEST(thingset_benchmark, test_init_100)
+{
+    benchmark_init(100);
+}
+
+ZTEST(thingset_benchmark, test_init_1k)
+{
+    benchmark_init(1000);
+}
+
+ZTEST(thingset_benchmark, test_init_10k)
+{
+    benchmark_init(10000);
+}
+
+ZTEST(thingset_benchmark, test_init_global)
+{
+    uint32_t start;
+    uint32_t cycles;
+
+    /* objects added via THINGSET_ADD_* macros are fixed at build time (test data from common) */
+    start = k_cycle_get_32();
+    thingset_init_global(&ts);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_init_global with %zu objects: %u cycles (%u us)\n", ts.num_objects, cycles,
+             k_cyc_to_us_floor32(cycles));
+
+    zassert_true(ts.num_objects > 0);
+}
+
+ZTEST_SUITE(thingset_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "objects.h"
+
+#include <stdio.h>
+#include <string.h>
+
+struct thingset_data_object objects[NUM_OBJECTS_MAX];
+
+static char names[NUM_OBJECTS_MAX][12];
+static uint32_t values[NUM_OBJECTS_MAX];
+
+void generate_objects(size_t num)
+{
+    uint16_t group_id = 0;
+
+    for (unsigned int i = 0; i < num; i++) {
+        uint16_t id = 0x1000 + i;
+        if (i % OBJECTS_PER_GROUP == 0) {
+            snprintf(names[i], sizeof(names[i]), "G%u", i / OBJECTS_PER_GROUP);
+            struct thingset_data_object group =
+                THINGSET_GROUP(THINGSET_ID_ROOT, id, names[i], THINGSET_NO_CALLBACK);
+            memcpy(&objects[i], &group, sizeof(group));
+            group_id = id;
+        }
+        else {
+            snprintf(names[i], sizeof(names[i]), "i%u", i % OBJECTS_PER_GROUP);
+            values[i] = i;
+            struct thingset_data_object item =
+                THINGSET_ITEM_UINT32(group_id, id, names[i], &values[i], THINGSET_ANY_RW,
+                                     i % OBJECTS_PER_GROUP == 1 ? SUBSET_BENCHMARK : 0);
+            memcpy(&objects[i], &item, sizeof(item));
+        }
+    }
+}
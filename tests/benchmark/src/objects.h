@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCHMARK_OBJECTS_H_
+#define BENCHMARK_OBJECTS_H_
+
+#include <thingset.h>
+
+#define NUM_OBJECTS_MAX   10000
+#define OBJECTS_PER_GROUP 100
+
+/* the first item of each group belongs to this subset */
+#define SUBSET_BENCHMARK (1U << 0)
+
+extern struct thingset_data_object objects[NUM_OBJECTS_MAX];
+
+/*
+ * Generate synthetic database with groups at root level, each containing OBJECTS_PER_GROUP - 1
+ * items. The ID of the object at index i is 0x1000 + i.
+ */
+void generate_objects(size_t num);
+
+#endif /* BENCHMARK_OBJECTS_H_ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "../../src/thingset_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_VALUES 1000
+
+ZTEST(thingset_benchmark_parse, test_parse_f32)
+{
+    char strings[NUM_VALUES][16];
+    uint32_t start;
+    uint32_t cycles_strtod;
+    uint32_t cycles_parse;
+    float value;
+
+    for (int i = 0; i < NUM_VALUES; i++) {
+        snprintf(strings[i], sizeof(strings[i]), "%.2f", -1000.0 + i * 1.234);
+    }
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++) {
+        value = strtod(strings[i], NULL);
+    }
+    cycles_strtod = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++) {
+        thingset_txt_parse_number(strings[i], strlen(strings[i]),
+                                  (union thingset_data_pointer){ .f32 = &value },
+                                  THINGSET_TYPE_F32, 0);
+    }
+    cycles_parse = k_cycle_get_32() - start;
+
+    TC_PRINT("parse %d f32 values: strtod %u cycles, thingset %u cycles\n", NUM_VALUES,
+             cycles_strtod, cycles_parse);
+}
+
+ZTEST(thingset_benchmark_parse, test_parse_i32)
+{
+    char strings[NUM_VALUES][16];
+    uint32_t start;
+    uint32_t cycles_strtol;
+    uint32_t cycles_parse;
+    int32_t value;
+
+    for (int i = 0; i < NUM_VALUES; i++) {
+        snprintf(strings[i], sizeof(strings[i]), "%d", (i - NUM_VALUES / 2) * 12345);
+    }
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++) {
+        value = strtol(strings[i], NULL, 0);
+    }
+    cycles_strtol = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < NUM_VALUES; i++) {
+        thingset_txt_parse_number(strings[i], strlen(strings[i]),
+                                  (union thingset_data_pointer){ .i32 = &value },
+                                  THINGSET_TYPE_I32, 0);
+    }
+    cycles_parse = k_cycle_get_32() - start;
+
+    TC_PRINT("parse %d i32 values: strtol %u cycles, thingset %u cycles\n", NUM_VALUES,
+             cycles_strtol, cycles_parse);
+}
+
+ZTEST_SUITE(thingset_benchmark_parse, NULL, NULL, NULL, NULL, NULL);
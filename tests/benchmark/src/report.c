@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include <string.h>
+
+#include "objects.h"
+
+static struct thingset_context ts;
+
+/* large enough for fixed-width values */
+static uint8_t buf[NUM_OBJECTS_MAX / OBJECTS_PER_GROUP * 10];
+
+/* generated objects with an additional subset object at the end */
+static void generate_objects_with_subset(size_t num)
+{
+    struct thingset_data_object subset =
+        THINGSET_SUBSET(THINGSET_ID_ROOT, 0xF00, "mBench", SUBSET_BENCHMARK, THINGSET_ANY_RW);
+
+    generate_objects(num - 1);
+    memcpy(&objects[num - 1], &subset, sizeof(subset));
+
+    thingset_init(&ts, objects, num);
+}
+
+static void benchmark_report_path(size_t num)
+{
+    uint32_t start;
+    uint32_t cycles;
+    int len;
+
+    generate_objects_with_subset(num);
+
+    /* first report builds the indices if CONFIG_THINGSET_INDEX_LAZY_BUILD is enabled */
+    len = thingset_report_path(&ts, buf, sizeof(buf), "mBench", THINGSET_BIN_IDS_VALUES);
+    zassert_true(len > 0);
+
+    start = k_cycle_get_32();
+    len = thingset_report_path(&ts, buf, sizeof(buf), "mBench", THINGSET_BIN_IDS_VALUES);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_report_path with %zu objects: %u cycles (%u us), %d bytes\n", num, cycles,
+             k_cyc_to_us_floor32(cycles), len);
+
+    zassert_true(len > 0);
+}
+
+ZTEST(thingset_benchmark_report, test_report_path_1k)
+{
+    benchmark_report_path(1000);
+}
+
+ZTEST(thingset_benchmark_report, test_report_path_10k)
+{
+    benchmark_report_path(10000);
+}
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+static void benchmark_report_render(size_t num)
+{
+    static struct thingset_report_template tmpl;
+    static uint8_t buf_exp[sizeof(buf)];
+    uint32_t start;
+    uint32_t cycles;
+    int len;
+    int err;
+
+    generate_objects_with_subset(num);
+
+    int len_exp = thingset_report_path(&ts, buf_exp, sizeof(buf_exp), "mBench",
+                                       THINGSET_BIN_IDS_VALUES);
+    zassert_true(len_exp > 0);
+
+    start = k_cycle_get_32();
+    err = thingset_report_prepare(&ts, "mBench", THINGSET_BIN_IDS_VALUES, &tmpl);
+    cycles = k_cycle_get_32() - start;
+    zassert_equal(0, err, "err: %d", err);
+
+    TC_PRINT("thingset_report_prepare with %zu objects: %u cycles (%u us)\n", num, cycles,
+             k_cyc_to_us_floor32(cycles));
+
+    start = k_cycle_get_32();
+    len = thingset_report_render(&tmpl, buf, sizeof(buf));
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_report_render with %zu objects: %u cycles (%u us), %d bytes\n", num,
+             cycles, k_cyc_to_us_floor32(cycles), len);
+
+    zassert_equal(len_exp, len);
+    zassert_mem_equal(buf_exp, buf, len);
+}
+
+ZTEST(thingset_benchmark_report, test_report_render_1k)
+{
+    benchmark_report_render(1000);
+}
+
+ZTEST(thingset_benchmark_report, test_report_render_10k)
+{
+    benchmark_report_render(10000);
+}
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+static void benchmark_report_patch(size_t num)
+{
+    static struct thingset_report_template tmpl;
+    uint32_t start;
+    uint32_t cycles;
+    int len;
+    int err;
+
+    generate_objects_with_subset(num);
+
+    err = thingset_report_prepare(&ts, "mBench", THINGSET_BIN_IDS_VALUES_FIXED_WIDTH, &tmpl);
+    zassert_equal(0, err, "err: %d", err);
+
+    start = k_cycle_get_32();
+    len = thingset_report_render(&tmpl, buf, sizeof(buf));
+    cycles = k_cycle_get_32() - start;
+    zassert_true(len > 0);
+
+    TC_PRINT("thingset_report_render (fixed width) with %zu objects: %u cycles (%u us), "
+             "%d bytes\n",
+             num, cycles, k_cyc_to_us_floor32(cycles), len);
+
+    start = k_cycle_get_32();
+    len = thingset_report_patch(&tmpl, buf, sizeof(buf));
+    cycles = k_cycle_get_32() - start;
+    zassert_true(len > 0);
+
+    TC_PRINT("thingset_report_patch with %zu objects: %u cycles (%u us), %d bytes\n", num,
+             cycles, k_cyc_to_us_floor32(cycles), len);
+}
+
+ZTEST(thingset_benchmark_report, test_report_patch_1k)
+{
+    benchmark_report_patch(1000);
+}
+
+ZTEST(thingset_benchmark_report, test_report_patch_10k)
+{
+    benchmark_report_patch(10000);
+}
+
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
+
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+
+static void benchmark_report_changes(size_t num)
+{
+    uint32_t version = 0;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t value;
+    int len;
+
+    generate_objects_with_subset(num);
+
+    len = thingset_report_path_changes(&ts, buf, sizeof(buf), "mBench", THINGSET_BIN_IDS_VALUES,
+                                       &version);
+    zassert_true(len > 0);
+
+    /* change the first item of the first group */
+    value = 42;
+    zassert_equal(0, thingset_set_value(&ts, 0x1001, &value));
+
+    start = k_cycle_get_32();
+    len = thingset_report_path_changes(&ts, buf, sizeof(buf), "mBench", THINGSET_BIN_IDS_VALUES,
+                                       &version);
+    cycles = k_cycle_get_32() - start;
+
+    TC_PRINT("thingset_report_path_changes with %zu objects: %u cycles (%u us), %d bytes\n", num,
+             cycles, k_cyc_to_us_floor32(cycles), len);
+
+    zassert_true(len > 0);
+}
+
+ZTEST(thingset_benchmark_report, test_report_changes_1k)
+{
+    benchmark_report_changes(1000);
+}
+
+ZTEST(thingset_benchmark_report, test_report_changes_10k)
+{
+    benchmark_report_changes(10000);
+}
+
+#endif /* CONFIG_THINGSET_CHANGE_TRACKING */
+
+ZTEST_SUITE(thingset_benchmark_report, NULL, NULL, NULL, NULL, NULL);
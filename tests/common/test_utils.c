@@ -51,3 +51,14 @@ size_t bin2hex_spaced(const uint8_t *bin, size_t bin_size, char *hex, size_t hex
     hex[pos - 1] = '\0';
     return pos - 1;
 }
+
+int test_source_read(uint8_t *buf, size_t len, void *user_data)
+{
+    struct test_source_data *src = user_data;
+
+    len = MIN(len, MIN(src->chunk_size, src->len - src->pos));
+    memcpy(buf, src->data + src->pos, len);
+    src->pos += len;
+
+    return len;
+}
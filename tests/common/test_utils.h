@@ -170,6 +170,17 @@
         zassert_equal(err, err_exp, "act: 0x%X, exp: 0x%X", -err, -err_exp); \
     }
 
+/* data provided to thingset_source_read_t callbacks in chunks of limited size */
+struct test_source_data
+{
+    const uint8_t *data;
+    size_t len;
+    size_t pos;
+    size_t chunk_size;
+};
+
 size_t hex2bin_spaced(const char *hex, uint8_t *bin, size_t bin_size);
 
 size_t bin2hex_spaced(const uint8_t *bin, size_t bin_size, char *hex, size_t hex_size);
+
+int test_source_read(uint8_t *buf, size_t len, void *user_data);
@@ -466,6 +466,48 @@ ZTEST(thingset_bin, test_fetch_metadata_parameterised_func)
 
 #endif /* CONFIG_THINGSET_METADATA_ENDPOINT */
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+
+/* canonical CBOR encoding of an unsigned integer as hex string */
+static void uint_to_cbor_hex(char *buf, size_t size, uint32_t value)
+{
+    if (value < 24) {
+        snprintf(buf, size, "%02X", value);
+    }
+    else if (value <= UINT8_MAX) {
+        snprintf(buf, size, "18 %02X", value);
+    }
+    else if (value <= UINT16_MAX) {
+        snprintf(buf, size, "19 %04X", value);
+    }
+    else {
+        snprintf(buf, size, "1A %08X", value);
+    }
+}
+
+ZTEST(thingset_bin, test_fetch_changes)
+{
+    uint32_t version = thingset_get_data_version(&ts);
+    char version_hex[12];
+    char req_hex[32];
+    char rsp_exp_hex[64];
+
+    /* write unchanged timestamp, which is still considered as a change */
+    THINGSET_ASSERT_REQUEST_HEX("07 00 A1 10 19 03E8", "84 F6 F6");
+
+    uint_to_cbor_hex(version_hex, sizeof(version_hex), version);
+    snprintf(req_hex, sizeof(req_hex), "05 18 1A %s", version_hex);
+    uint_to_cbor_hex(version_hex, sizeof(version_hex), version + 1);
+    snprintf(rsp_exp_hex, sizeof(rsp_exp_hex),
+             "85 F6 "
+             "82 %s "         /* array with current version and map */
+             "A1 10 19 03E8", /* t_s: 1000 */
+             version_hex);
+    THINGSET_ASSERT_REQUEST_HEX(req_hex, rsp_exp_hex);
+}
+
+#endif /* CONFIG_THINGSET_CHANGES_ENDPOINT */
+
 ZTEST(thingset_bin, test_update_timestamp_zero_id)
 {
     const char req_hex[] = "07 00 A1 10 00";
@@ -982,16 +1024,123 @@ ZTEST(thingset_bin, test_import_data)
         "10 19 03E9 "  /* t_s */
         "19 02 01 F4"; /* Types/wBool */
 
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    uint32_t version = thingset_get_data_version(&ts);
+#endif
+
     THINGSET_ASSERT_IMPORT_HEX_IDS(data_hex, 0, THINGSET_WRITE_MASK);
 
     zassert_equal(timestamp, 1001);
     zassert_equal(b, false);
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    zassert_equal(thingset_get_data_version(&ts), version + 2);
+#endif
+
+    /* reset to default values */
+    timestamp = 1000;
+    b = true;
+}
+
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+ZTEST(thingset_bin, test_import_data_from_source_ids)
+{
+    const char data_hex[] =
+        "A3 "
+        "10 19 03E9 "          /* t_s */
+        "19 0FFF 83 01 02 03 " /* unknown */
+        "19 02 01 F4";         /* Types/wBool */
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    int data_len = hex2bin_spaced(data_hex, data, sizeof(data));
+    struct test_source_data src = { data, data_len, 0, 3 };
+    uint8_t window[8];
+    struct thingset_source source = { window, sizeof(window), test_source_read, &src };
+    int err;
+
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_BIN_IDS_VALUES);
+    zassert_equal(0, err, "err: 0x%X", -err);
+    zassert_equal(1001, timestamp);
+    zassert_equal(false, b);
+
+    /* reset to default values */
+    timestamp = 1000;
+    b = true;
+}
+
+ZTEST(thingset_bin, test_import_data_from_source_invalid_key)
+{
+    const char data_hex[] =
+        "A3 "
+        "20 F4 "       /* negative integer as key */
+        "10 19 03E9 "  /* t_s */
+        "19 02 01 F4"; /* Types/wBool */
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    int data_len = hex2bin_spaced(data_hex, data, sizeof(data));
+    struct test_source_data src = { data, data_len, 0, 3 };
+    uint8_t window[8];
+    struct thingset_source source = { window, sizeof(window), test_source_read, &src };
+    int err;
+
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_BIN_IDS_VALUES);
+    zassert_equal(-THINGSET_ERR_BAD_REQUEST, err, "err: 0x%X", -err);
+    zassert_equal(1000, timestamp);
+
+    /* same error as for the entire data in a buffer */
+    THINGSET_ASSERT_IMPORT_HEX_IDS(data_hex, -THINGSET_ERR_BAD_REQUEST, THINGSET_WRITE_MASK);
+
+    /* text keys are not accepted for IDs either */
+    src.pos = 0;
+    data[1] = 0x61;
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_BIN_IDS_VALUES);
+    zassert_equal(-THINGSET_ERR_BAD_REQUEST, err, "err: 0x%X", -err);
+    zassert_equal(1000, timestamp);
+}
+
+ZTEST(thingset_bin, test_import_data_from_source_names)
+{
+    const char data_hex[] =
+        "BF "                                /* indefinite-length map */
+        "63 745F73 19 03E9 "                 /* t_s */
+        "65 5479706573 A2 "                  /* Types */
+        "65 77426F6F6C F4 "                  /* wBool */
+        "64 77553332 18 7B "                 /* wU32 */
+        "6A 54797065732F77493136 24 "        /* Types/wI16 */
+        "67 556E6B6E6F776E A1 63 666F6F 01 " /* Unknown */
+        "FF";
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    int data_len = hex2bin_spaced(data_hex, data, sizeof(data));
+    struct test_source_data src = { data, data_len, 0, 3 };
+    uint8_t window[16];
+    struct thingset_source source = { window, sizeof(window), test_source_read, &src };
+    int err;
+
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_BIN_NAMES_VALUES);
+    zassert_equal(0, err, "err: 0x%X", -err);
+    zassert_equal(1001, timestamp);
+    zassert_equal(false, b);
+    zassert_equal(123, u32);
+    zassert_equal(-5, i16);
+
+    /* window too small for a single item */
+    src.pos = 0;
+    source.size = 4;
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_BIN_NAMES_VALUES);
+    zassert_equal(-THINGSET_ERR_REQUEST_TOO_LARGE, err, "err: 0x%X", -err);
 
     /* reset to default values */
     timestamp = 1000;
     b = true;
+    u32 = 32;
+    i16 = -16;
 }
 
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
 ZTEST(thingset_bin, test_import_report)
 {
     uint8_t data[THINGSET_TEST_BUF_SIZE];
@@ -1069,8 +1218,15 @@ ZTEST(thingset_bin, test_import_record)
     zassert_equal(records[1].f32_arr[1], (float)4.56F);
     zassert_equal(records[1].f32_arr[2], (float)7.89F);
 
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    uint32_t version = thingset_get_data_version(&ts);
+#endif
+
     err = thingset_import_record(&ts, data, data_len, &endpoint, THINGSET_BIN_IDS_VALUES);
     zassert_equal(err, 0, "act: 0x%X", -err);
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+    zassert_equal(thingset_get_data_version(&ts), version + 1);
+#endif
 
     zassert_equal(records[1].b, false);
     zassert_equal(records[1].f32_arr[0], (float)1.0F);
@@ -1083,6 +1239,153 @@ ZTEST(thingset_bin, test_import_record)
     records[1].f32_arr[2] = 7.89F;
 }
 
+/* the nested map in the list of records requires more decoder states than available by default */
+#if CONFIG_THINGSET_BINARY_MAX_DEPTH > 4
+
+struct writable_record
+{
+    uint32_t timestamp;
+    bool b;
+    uint8_t u8;
+};
+
+static struct writable_record writable_records[2];
+
+static THINGSET_DEFINE_RECORDS(writable_records_obj, writable_records, 2);
+
+static struct thingset_data_object writable_records_data_objects[] = {
+    THINGSET_RECORDS(THINGSET_ID_ROOT, 0x900, "wRecords", &writable_records_obj, THINGSET_ANY_RW,
+                     0),
+    THINGSET_RECORD_ITEM_UINT32(0x900, 0x901, "t_s", struct writable_record, timestamp),
+    THINGSET_RECORD_ITEM_BOOL(0x900, 0x902, "wBool", struct writable_record, b),
+    THINGSET_RECORD_ITEM_UINT8(0x900, 0x903, "wU8", struct writable_record, u8),
+};
+
+ZTEST(thingset_bin, test_import_records)
+{
+    struct thingset_context ts_local;
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    int err;
+
+    const char data_hex[] =
+        "A1 19 09 00 82 "
+        "A3 19 09 01 19 03 E8 19 09 02 F5 19 09 03 05 " /* fields in order */
+        "A3 19 09 03 07 19 09 FF 00 19 09 01 19 03 E9";  /* reverse order and unknown field */
+    int data_len = hex2bin_spaced(data_hex, data, sizeof(data));
+
+    thingset_init(&ts_local, writable_records_data_objects,
+                  ARRAY_SIZE(writable_records_data_objects));
+
+    err = thingset_import_data(&ts_local, data, data_len, THINGSET_WRITE_MASK,
+                               THINGSET_BIN_IDS_VALUES);
+    zassert_equal(err, 0, "act: 0x%X", -err);
+
+    zassert_equal(writable_records[0].timestamp, 1000);
+    zassert_equal(writable_records[0].b, true);
+    zassert_equal(writable_records[0].u8, 5);
+    zassert_equal(writable_records[1].timestamp, 1001);
+    zassert_equal(writable_records[1].b, false);
+    zassert_equal(writable_records[1].u8, 7);
+}
+
+#endif /* CONFIG_THINGSET_BINARY_MAX_DEPTH > 4 */
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+/*
+ * Process the request with decreasing response buffer sizes, so that the response is split at all
+ * possible positions, and compare the concatenated pieces with the complete response.
+ *
+ * @returns Smallest buffer size the response could be retrieved with
+ */
+static size_t assert_request_continued(const char *req_hex)
+{
+    uint8_t req[THINGSET_TEST_BUF_SIZE];
+    uint8_t rsp_exp[THINGSET_TEST_BUF_SIZE];
+    uint8_t rsp_act[THINGSET_TEST_BUF_SIZE];
+    uint8_t buf[THINGSET_TEST_BUF_SIZE];
+    size_t buf_size;
+    int len;
+
+    int req_len = hex2bin_spaced(req_hex, req, sizeof(req));
+    int rsp_exp_len = thingset_process_message(&ts, req, req_len, rsp_exp, sizeof(rsp_exp));
+    zassert_true(rsp_exp_len > 0);
+    zassert_equal(0x85, rsp_exp[0]);
+    zassert_false(thingset_response_continued(&ts));
+
+    for (buf_size = rsp_exp_len - 1; buf_size >= 4; buf_size--) {
+        size_t pos = 0;
+        len = thingset_process_message(&ts, req, req_len, buf, buf_size);
+        if (buf[0] != 0x85) {
+            /* the first element does not fit anymore */
+            zassert_equal(0xE1, buf[0], "buf_size: %zu", buf_size);
+            break;
+        }
+
+        while (len > 0) {
+            zassert_true(pos + len <= sizeof(rsp_act));
+            memcpy(rsp_act + pos, buf, len);
+            pos += len;
+            len = thingset_process_continue(&ts, buf, buf_size);
+        }
+
+        if (len == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            /* a later element does not fit anymore */
+            break;
+        }
+        zassert_equal(0, len, "buf_size: %zu, len: %d", buf_size, len);
+        zassert_false(thingset_response_continued(&ts));
+        zassert_equal(rsp_exp_len, pos, "buf_size: %zu", buf_size);
+        zassert_mem_equal(rsp_exp, rsp_act, pos, "buf_size: %zu", buf_size);
+    }
+
+    return buf_size + 1;
+}
+
+ZTEST(thingset_bin, test_get_continued)
+{
+    zassert_true(assert_request_continued("01 19 0200") < 24);         /* Types */
+    zassert_true(assert_request_continued("01 66 4E6573746564") < 24); /* Nested */
+    zassert_true(assert_request_continued("01 82 19 0600 01") < 24);   /* Records/1 */
+}
+
+ZTEST(thingset_bin, test_fetch_continued)
+{
+    /* names of Types */
+    zassert_true(assert_request_continued("05 19 0200 F6") < 16);
+
+    /* wF32, wBool, wU32 and wI64 of Types */
+    zassert_true(assert_request_continued("05 19 0200 84 19 020A 19 0201 19 0206 19 0209") < 16);
+
+    /* paths of Types/wBool and Arrays/wU16 */
+    zassert_true(assert_request_continued("05 17 82 19 0201 19 0304") < 24);
+}
+
+ZTEST(thingset_bin, test_process_continue_discarded)
+{
+    uint8_t req[] = { 0x01, 0x19, 0x02, 0x00 }; /* GET Types */
+    uint8_t buf[16];
+    int len;
+
+    len = thingset_process_message(&ts, req, sizeof(req), buf, sizeof(buf));
+    zassert_true(len > 0);
+    zassert_equal(0x85, buf[0]);
+    zassert_true(thingset_response_continued(&ts));
+
+    len = thingset_process_continue(&ts, buf, sizeof(buf));
+    zassert_true(len > 0);
+    zassert_true(thingset_response_continued(&ts));
+
+    /* new request discards the remaining pieces of the previous response */
+    THINGSET_ASSERT_REQUEST_HEX("01 19 0704", "85 F6 FA 3F99999A");
+    zassert_false(thingset_response_continued(&ts));
+
+    len = thingset_process_continue(&ts, buf, sizeof(buf));
+    zassert_equal(0, len);
+}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 static void *thingset_setup(void)
 {
     thingset_init_global(&ts);
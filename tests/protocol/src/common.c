@@ -10,6 +10,9 @@
 
 #include "../../src/thingset_internal.h"
 
+#include <zcbor_encode.h>
+
+#include "data.h"
 #include "test_utils.h"
 
 static struct thingset_context ts;
@@ -82,6 +85,62 @@ ZTEST(thingset_common, test_endpoint_from_path)
     zassert_equal(ret, -THINGSET_ERR_NOT_FOUND);
 }
 
+#ifdef CONFIG_THINGSET_ENDPOINT_CACHE
+
+ZTEST(thingset_common, test_endpoint_cache)
+{
+    struct thingset_endpoint endpoint;
+    uint32_t hits = ts.endpoint_cache_hits;
+    uint32_t misses = ts.endpoint_cache_misses;
+    int ret;
+
+    /* path may already be cached from previous tests */
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Records/1", 9);
+    zassert_equal(ret, 0);
+    zassert_equal(ts.endpoint_cache_hits + ts.endpoint_cache_misses, hits + misses + 1);
+
+    hits = ts.endpoint_cache_hits;
+    misses = ts.endpoint_cache_misses;
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Records/1", 9);
+    zassert_equal(ret, 0);
+    zassert_equal(ts.endpoint_cache_hits, hits + 1);
+    zassert_equal(endpoint.object->id, 0x600);
+    zassert_equal(endpoint.index, 1);
+
+    /* same prefix and length, but different path must not be served from cache */
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Records/2", 9);
+    zassert_equal(ret, 0);
+    zassert_equal(endpoint.index, 2);
+    zassert_equal(ts.endpoint_cache_hits, hits + 1);
+
+    /* not found paths are not cached */
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Typess", 6);
+    zassert_equal(ret, -THINGSET_ERR_NOT_FOUND);
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Typess", 6);
+    zassert_equal(ret, -THINGSET_ERR_NOT_FOUND);
+    zassert_equal(ts.endpoint_cache_hits, hits + 1);
+
+    /* each other resolved path moves the entry for Records/1 further back in the LRU order */
+    const char *paths[] = { "Types", "Arrays", "Exec", "Access", "Nested", "Types/wBool" };
+    for (int i = 0; i < ARRAY_SIZE(paths); i++) {
+        ret = thingset_endpoint_by_path(&ts, &endpoint, paths[i], strlen(paths[i]));
+        zassert_equal(ret, 0);
+    }
+    hits = ts.endpoint_cache_hits;
+    ret = thingset_endpoint_by_path(&ts, &endpoint, "Records/1", 9);
+    zassert_equal(ret, 0);
+    zassert_equal(endpoint.index, 1);
+    if (CONFIG_THINGSET_ENDPOINT_CACHE_SIZE > ARRAY_SIZE(paths) + 1) {
+        zassert_equal(ts.endpoint_cache_hits, hits + 1);
+    }
+    else {
+        /* evicted */
+        zassert_equal(ts.endpoint_cache_hits, hits);
+    }
+}
+
+#endif /* CONFIG_THINGSET_ENDPOINT_CACHE */
+
 ZTEST(thingset_common, test_serialize_path)
 {
     struct thingset_data_object *obj;
@@ -114,6 +173,134 @@ ZTEST(thingset_common, test_serialize_path)
     zassert_mem_equal(buf, "Nested/Obj2/rItem1_V", len);
 }
 
+ZTEST(thingset_common, test_path_round_trip)
+{
+    struct thingset_endpoint endpoint;
+    char buf[100];
+    int len;
+    int ret;
+
+    for (unsigned int i = 0; i < ts.num_objects; i++) {
+        struct thingset_data_object *obj = &ts.data_objects[i];
+        len = thingset_get_path(&ts, buf, sizeof(buf), obj);
+        zassert_true(len > 0, "ID 0x%X", obj->id);
+        zassert_equal(strlen(buf), len, "ID 0x%X", obj->id);
+#if defined(CONFIG_THINGSET_PATH_INDEX) && !defined(CONFIG_THINGSET_INDEX_LAZY_BUILD)
+        /* with lazy build, the index is not yet available without a previous request */
+        zassert_equal(ts.path_lengths[i], len, "ID 0x%X", obj->id);
+#endif
+
+        ret = thingset_endpoint_by_path(&ts, &endpoint, buf, len);
+        zassert_equal(ret, 0, "ID 0x%X", obj->id);
+        zassert_equal(endpoint.object, obj, "ID 0x%X", obj->id);
+        zassert_equal(endpoint.index, THINGSET_ENDPOINT_INDEX_NONE, "ID 0x%X", obj->id);
+    }
+
+    len = thingset_get_path(&ts, buf, 5, thingset_get_object_by_id(&ts, 0x707));
+    zassert_equal(len, -THINGSET_ERR_RESPONSE_TOO_LARGE);
+}
+
+ZTEST(thingset_common, test_record_fields)
+{
+    struct thingset_data_object *records = thingset_get_object_by_id(&ts, 0x600);
+    unsigned int field_pos;
+    unsigned int child_pos;
+
+    struct thingset_data_object *field = thingset_get_first_record_field(&ts, records, &field_pos);
+    struct thingset_data_object *child = thingset_get_first_child(&ts, records, &child_pos);
+    zassert_not_null(field);
+    while (child != NULL) {
+        zassert_equal(field, child);
+        field = thingset_get_next_record_field(&ts, records, &field_pos);
+        child = thingset_get_next_child(&ts, records, &child_pos);
+    }
+    zassert_is_null(field);
+
+    /* temporary copies of records objects (e.g. nested records) are found by their ID */
+    struct thingset_data_object copy;
+    memcpy(&copy, records, sizeof(copy));
+    field = thingset_get_first_record_field(&ts, &copy, &field_pos);
+    zassert_equal(field, thingset_get_first_child(&ts, records, &child_pos));
+}
+
+#if defined(CONFIG_THINGSET_BINARY_KEY_CACHE) || defined(CONFIG_THINGSET_TEXT_KEY_CACHE)
+
+ZTEST(thingset_common, test_key_cache)
+{
+    zassert_true(ts.key_cache_valid);
+
+    for (unsigned int i = 0; i < ts.num_objects; i++) {
+        zassert_equal(ts.key_name_lengths[i], strlen(ts.data_objects[i].name));
+        zassert_equal(thingset_get_name_length(&ts, &ts.data_objects[i]),
+                      strlen(ts.data_objects[i].name));
+    }
+
+#ifdef CONFIG_THINGSET_BINARY_KEY_CACHE
+    zcbor_state_t encoder[1];
+    uint8_t buf[3];
+
+    /* pre-encoded keys must be identical to the keys encoded by zcbor */
+    for (unsigned int i = 0; i < ts.num_objects; i++) {
+        zcbor_new_encode_state(encoder, ARRAY_SIZE(encoder), buf, sizeof(buf), 1);
+        zcbor_uint32_put(encoder, ts.data_objects[i].id);
+        zassert_mem_equal(ts.bin_key_ids[i], buf, encoder->payload - buf, "ID 0x%X",
+                          ts.data_objects[i].id);
+    }
+#endif
+}
+
+#endif
+
+ZTEST(thingset_common, test_object_by_id)
+{
+    for (unsigned int i = 0; i < ts.num_objects; i++) {
+        struct thingset_data_object *obj = &ts.data_objects[i];
+        zassert_equal(thingset_get_object_by_id(&ts, obj->id), obj, "ID 0x%X", obj->id);
+    }
+
+    zassert_equal(thingset_get_object_by_id(&ts, 0x0), NULL);
+    zassert_equal(thingset_get_object_by_id(&ts, 0x7FFF), NULL);
+}
+
+static void assert_subset_members(uint16_t subsets)
+{
+    size_t count = 0;
+    unsigned int next = thingset_next_subset_member(&ts, subsets, 0);
+
+    for (unsigned int i = 0; i < ts.num_objects; i++) {
+        if (ts.data_objects[i].subsets & subsets) {
+            zassert_equal(next, i, "subsets 0x%X", subsets);
+            next = thingset_next_subset_member(&ts, subsets, i + 1);
+            count++;
+        }
+    }
+    zassert_equal(next, ts.num_objects, "subsets 0x%X", subsets);
+    zassert_equal(thingset_count_subset_members(&ts, subsets), count, "subsets 0x%X", subsets);
+}
+
+ZTEST(thingset_common, test_subset_members)
+{
+    assert_subset_members(SUBSET_LIVE);
+    assert_subset_members(SUBSET_NVM);
+    assert_subset_members(SUBSET_LIVE | SUBSET_NVM);
+    assert_subset_members(1U << (THINGSET_NUM_SUBSETS - 1));
+
+#ifndef CONFIG_THINGSET_IMMUTABLE_OBJECTS
+    struct thingset_data_object *obj = thingset_get_object_by_id(&ts, 0x202);
+    uint16_t subsets = obj->subsets;
+
+    thingset_set_object_subsets(&ts, obj, subsets | SUBSET_LIVE | SUBSET_NVM);
+    assert_subset_members(SUBSET_LIVE);
+    assert_subset_members(SUBSET_NVM);
+    assert_subset_members(SUBSET_LIVE | SUBSET_NVM);
+
+    thingset_set_object_subsets(&ts, obj, subsets);
+    assert_subset_members(SUBSET_LIVE);
+    assert_subset_members(SUBSET_NVM);
+    assert_subset_members(SUBSET_LIVE | SUBSET_NVM);
+#endif
+}
+
 static void *thingset_setup(void)
 {
     thingset_init_global(&ts);
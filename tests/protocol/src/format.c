@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "../../src/thingset_internal.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CONFIG_THINGSET_TEXT_MODE
+
+static const int32_t values_i32[] = {
+    0, 1, -1, 9, 10, -10, 99, 100, 12345, -98765, 1000000, INT32_MAX, INT32_MIN,
+};
+
+static const int64_t values_i64[] = {
+    0,          -1,          999999999,  1000000000,         -1000000000,
+    4294967295, 4294967296,  INT64_MAX,  1000000000000000000, -999999999999999999,
+    INT64_MIN,
+};
+
+ZTEST(thingset_format, test_format_integers)
+{
+    char exp[24];
+    char act[24];
+    int len;
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(values_i32); i++) {
+        snprintf(exp, sizeof(exp), "%" PRIi32, values_i32[i]);
+        len = thingset_txt_format_i32(act, sizeof(act), values_i32[i]);
+        zassert_equal(len, strlen(exp));
+        zassert_mem_equal(act, exp, len + 1);
+
+        snprintf(exp, sizeof(exp), "%" PRIu32, (uint32_t)values_i32[i]);
+        len = thingset_txt_format_u32(act, sizeof(act), (uint32_t)values_i32[i]);
+        zassert_equal(len, strlen(exp));
+        zassert_mem_equal(act, exp, len + 1);
+    }
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(values_i64); i++) {
+        snprintf(exp, sizeof(exp), "%" PRIi64, values_i64[i]);
+        len = thingset_txt_format_i64(act, sizeof(act), values_i64[i]);
+        zassert_equal(len, strlen(exp));
+        zassert_mem_equal(act, exp, len + 1);
+
+        snprintf(exp, sizeof(exp), "%" PRIu64, (uint64_t)values_i64[i]);
+        len = thingset_txt_format_u64(act, sizeof(act), (uint64_t)values_i64[i]);
+        zassert_equal(len, strlen(exp));
+        zassert_mem_equal(act, exp, len + 1);
+    }
+
+    /* buffer too small: nothing written, required length returned like snprintf */
+    memset(act, 'x', sizeof(act));
+    len = thingset_txt_format_i32(act, 5, -12345);
+    zassert_equal(len, 6);
+    zassert_equal(act[0], 'x');
+}
+
+static const float values_f32[] = {
+    0.0F, -0.0F, 0.5F, 1.5F, 2.5F, -3.2F, 0.125F, 0.005F, 1.0E-10F, 1.17549435E-38F, 1.0E-45F,
+    16777216.0F, 1.0E20F, -3.4028235E38F, 123456.789F, 0.1F, 9.9999F,
+};
+
+/* simple xorshift generator for reproducible pseudo-random bit patterns */
+static uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void check_format_f32(float value)
+{
+    char exp[64];
+    char act[64];
+    int len;
+
+    for (int decimals = 0; decimals <= 9; decimals++) {
+        snprintf(exp, sizeof(exp), "%.*f", decimals, (double)value);
+        len = thingset_txt_format_f32(act, sizeof(act), value, decimals);
+        zassert_equal(len, strlen(exp), "%s != %s", act, exp);
+        zassert_mem_equal(act, exp, len + 1, "%s != %s", act, exp);
+    }
+
+    len = thingset_txt_format_f32(act, sizeof(act), value, THINGSET_DECIMALS_SHORTEST);
+    zassert_equal(len, strlen(act));
+    if (fabsf(value) >= 0.1F) {
+        /* smaller values may need more than the max. 9 decimals to get 9 significant digits */
+        zassert_equal(strtof(act, NULL), value, "%s", act);
+    }
+}
+
+ZTEST(thingset_format, test_format_f32)
+{
+    char act[16];
+    uint32_t state = 0x12345678;
+    int len;
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(values_f32); i++) {
+        check_format_f32(values_f32[i]);
+    }
+
+    for (int i = 0; i < 10000; i++) {
+        uint32_t bits = xorshift32(&state);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        if (!isnan(value) && !isinf(value)) {
+            check_format_f32(value);
+        }
+    }
+
+    len = thingset_txt_format_f32(act, sizeof(act), 0.1F, THINGSET_DECIMALS_SHORTEST);
+    zassert_mem_equal(act, "0.1", len + 1);
+
+    len = thingset_txt_format_f32(act, sizeof(act), 100.0F, THINGSET_DECIMALS_SHORTEST);
+    zassert_mem_equal(act, "100", len + 1);
+}
+
+ZTEST(thingset_format, test_format_f32_decimals_max)
+{
+    char exp[64];
+    char act[64];
+    int len;
+
+    len = thingset_txt_format_f32(exp, sizeof(exp), 1.0F / 3.0F, THINGSET_DECIMALS_MAX);
+    zassert_mem_equal(exp, "0.333333343", len + 1);
+
+    /* more decimals are reduced to the maximum */
+    len = thingset_txt_format_f32(act, sizeof(act), 1.0F / 3.0F, THINGSET_DECIMALS_MAX + 1);
+    zassert_mem_equal(act, exp, len + 1);
+
+    len = thingset_txt_format_f32(act, sizeof(act), -123.5F, 20);
+    zassert_mem_equal(act, "-123.500000000", len + 1);
+
+    /* shortest representation with the maximum number of decimals */
+    len = thingset_txt_format_f32(act, sizeof(act), 1.0F / 3.0F, THINGSET_DECIMALS_SHORTEST);
+    zassert_mem_equal(act, "0.33333334", len + 1);
+
+    len = thingset_txt_format_f32(act, sizeof(act), 1.0E-10F, THINGSET_DECIMALS_SHORTEST);
+    zassert_mem_equal(act, "0.000000000", len + 1);
+}
+
+ZTEST_SUITE(thingset_format, NULL, NULL, NULL, NULL, NULL);
+
+#endif /* CONFIG_THINGSET_TEXT_MODE */
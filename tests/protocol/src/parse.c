@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) The ThingSet Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include <thingset.h>
+
+#include "../../src/thingset_internal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CONFIG_THINGSET_TEXT_MODE
+
+static const char *const strings_f32[] = {
+    "0",
+    "-0.0",
+    "1",
+    "-3.2",
+    "52.8",
+    "1.5e2",
+    "0.1",
+    "3.4028235e38",
+    "3.40282356e38", /* rounds down to FLT_MAX */
+    "1.17549435e-38",
+    "1.4e-45",
+    "7.006492321624087e-46", /* rounds up to smallest subnormal */
+    "16777217",              /* tie between two floats, rounds to even */
+    "0.30000000000000000000000000001",
+    "123456789012345678901234567890",
+    "0x1F",
+};
+
+/* simple xorshift generator for reproducible pseudo-random bit patterns */
+static uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void check_parse_f32(const char *str)
+{
+    float exp = strtof(str, NULL);
+    float act = 1.0F;
+    int err;
+
+    err = thingset_txt_parse_number(str, strlen(str), (union thingset_data_pointer){ .f32 = &act },
+                                    THINGSET_TYPE_F32, 0);
+    zassert_equal(err, 0, "%s", str);
+    zassert_mem_equal(&act, &exp, sizeof(float), "%s", str);
+}
+
+ZTEST(thingset_parse, test_parse_f32)
+{
+    char str[64];
+    uint32_t state = 0x12345678;
+    float value;
+    int err;
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(strings_f32); i++) {
+        check_parse_f32(strings_f32[i]);
+    }
+
+    /* overflow and invalid format */
+    err = thingset_txt_parse_number("3.5e38", 6, (union thingset_data_pointer){ .f32 = &value },
+                                    THINGSET_TYPE_F32, 0);
+    zassert_equal(err, -THINGSET_ERR_UNSUPPORTED_FORMAT);
+
+    err = thingset_txt_parse_number("1.2.3", 5, (union thingset_data_pointer){ .f32 = &value },
+                                    THINGSET_TYPE_F32, 0);
+    zassert_equal(err, -THINGSET_ERR_UNSUPPORTED_FORMAT);
+
+    for (int i = 0; i < 10000; i++) {
+        uint32_t bits = xorshift32(&state);
+        memcpy(&value, &bits, sizeof(value));
+        if (isnan(value) || isinf(value)) {
+            continue;
+        }
+        /* shortest round-trip, fewer and more digits than required */
+        snprintf(str, sizeof(str), "%.9g", (double)value);
+        check_parse_f32(str);
+        snprintf(str, sizeof(str), "%.4e", (double)value);
+        check_parse_f32(str);
+        snprintf(str, sizeof(str), "%.17g", (double)value);
+        check_parse_f32(str);
+    }
+}
+
+ZTEST(thingset_parse, test_parse_integer)
+{
+    int64_t i64;
+    uint64_t u64;
+    int8_t i8;
+    int err;
+
+    err = thingset_txt_parse_number("-9223372036854775808", 20,
+                                    (union thingset_data_pointer){ .i64 = &i64 },
+                                    THINGSET_TYPE_I64, 0);
+    zassert_equal(err, 0);
+    zassert_equal(i64, INT64_MIN);
+
+    err = thingset_txt_parse_number("18446744073709551615", 20,
+                                    (union thingset_data_pointer){ .u64 = &u64 },
+                                    THINGSET_TYPE_U64, 0);
+    zassert_equal(err, 0);
+    zassert_equal(u64, UINT64_MAX);
+
+    err = thingset_txt_parse_number("18446744073709551616", 20,
+                                    (union thingset_data_pointer){ .u64 = &u64 },
+                                    THINGSET_TYPE_U64, 0);
+    zassert_equal(err, -THINGSET_ERR_UNSUPPORTED_FORMAT);
+
+    /* only the given length is parsed */
+    err = thingset_txt_parse_number("-12345", 3, (union thingset_data_pointer){ .i8 = &i8 },
+                                    THINGSET_TYPE_I8, 0);
+    zassert_equal(err, 0);
+    zassert_equal(i8, -12);
+}
+
+ZTEST_SUITE(thingset_parse, NULL, NULL, NULL, NULL, NULL);
+
+#endif /* CONFIG_THINGSET_TEXT_MODE */
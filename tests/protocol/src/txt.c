@@ -236,6 +236,32 @@ ZTEST(thingset_txt, test_fetch_float_array)
     THINGSET_ASSERT_REQUEST_TXT("?Arrays [\"wF32\"]", ":85 [[-1.1,-2.2,-3.3]]");
 }
 
+ZTEST(thingset_txt, test_get_array_buffer_too_small)
+{
+    const char req[] = "?Arrays/wF32";
+    const char rsp_exp[] = ":85 [-1.1,-2.2,-3.3]";
+    /* guard bytes in front of the response buffer to detect writes before it */
+    uint8_t buf[8 + sizeof(rsp_exp) + 1];
+    uint8_t *rsp_act = buf + 8;
+    int len;
+
+    /* cut off the buffer at every position, including the middle of array elements */
+    for (size_t size = sizeof(buf) - 8; size >= 4; size--) {
+        memset(buf, 0xAA, sizeof(buf));
+        len = thingset_process_message(&ts, req, strlen(req), rsp_act, size);
+        if (rsp_act[1] == '8') {
+            zassert_equal(strlen(rsp_exp), len, "size: %zu, len: %d", size, len);
+            zassert_mem_equal(rsp_exp, rsp_act, sizeof(rsp_exp));
+        }
+        else {
+            zassert_mem_equal(":E1", rsp_act, 3, "size: %zu", size);
+        }
+        for (size_t i = 0; i < 8; i++) {
+            zassert_equal(0xAA, buf[i], "size: %zu, i: %zu", size, i);
+        }
+    }
+}
+
 #ifdef CONFIG_THINGSET_METADATA_ENDPOINT
 
 ZTEST(thingset_txt, test_fetch_metadata)
@@ -246,6 +272,59 @@ ZTEST(thingset_txt, test_fetch_metadata)
 
 #endif /* CONFIG_THINGSET_METADATA_ENDPOINT */
 
+#ifdef CONFIG_THINGSET_CHANGES_ENDPOINT
+
+ZTEST(thingset_txt, test_fetch_changes)
+{
+    uint32_t version = thingset_get_data_version(&ts);
+    char req[32];
+    char rsp_exp[64];
+
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wBool\":true}", ":84");
+
+    snprintf(req, sizeof(req), "?_Changes %u", version);
+    snprintf(rsp_exp, sizeof(rsp_exp), ":85 [%u,{\"Types/wBool\":true}]", version + 1);
+    THINGSET_ASSERT_REQUEST_TXT(req, rsp_exp);
+
+    /* no further changes since the version returned with the previous response */
+    snprintf(req, sizeof(req), "?_Changes %u", version + 1);
+    snprintf(rsp_exp, sizeof(rsp_exp), ":85 [%u,{}]", version + 1);
+    THINGSET_ASSERT_REQUEST_TXT(req, rsp_exp);
+}
+
+ZTEST(thingset_txt, test_fetch_changes_buffer_too_small)
+{
+    uint32_t version = thingset_get_data_version(&ts);
+    char req[32];
+    char rsp_exp[64];
+    uint8_t rsp_act[64];
+    int len;
+
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wBool\":true}", ":84");
+
+    snprintf(req, sizeof(req), "?_Changes %u", version);
+    snprintf(rsp_exp, sizeof(rsp_exp), ":85 [%u,{\"Types/wBool\":true}]", version + 1);
+
+    /* cut off the buffer at every position, including the closing brackets */
+    for (size_t size = strlen(rsp_exp) + 1; size >= 4; size--) {
+        len = thingset_process_message(&ts, req, strlen(req), rsp_act, size);
+        if (rsp_act[1] == '8') {
+            zassert_equal(strlen(rsp_exp), len, "size: %zu, len: %d", size, len);
+            zassert_mem_equal(rsp_exp, rsp_act, strlen(rsp_exp) + 1);
+        }
+        else {
+            zassert_mem_equal(":E1", rsp_act, 3, "size: %zu", size);
+        }
+    }
+}
+
+ZTEST(thingset_txt, test_fetch_changes_invalid)
+{
+    THINGSET_ASSERT_REQUEST_TXT("?_Changes \"foo\"", ":A0 \"Data version required\"");
+}
+
+#endif /* CONFIG_THINGSET_CHANGES_ENDPOINT */
+
 #if CONFIG_THINGSET_JSON_STRING_ESCAPING
 
 ZTEST(thingset_txt, test_fetch_escaped_string)
@@ -299,6 +378,74 @@ ZTEST(thingset_txt, test_update_whitespaces)
     i32 = -32;
 }
 
+ZTEST(thingset_txt, test_update_number_range)
+{
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU8\":255,\"wI8\":-128,\"wI16\":1.5e2}", ":84");
+    zassert_equal(255, u8);
+    zassert_equal(-128, i8);
+    zassert_equal(150, i16);
+
+    /* out of range values must not be truncated */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU8\":256}", ":AF");
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wI8\":-129}", ":AF");
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU16\":-1}", ":AF");
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wI32\":abc}", ":AF");
+    zassert_equal(255, u8);
+    zassert_equal(-128, i8);
+
+    u8 = 8;
+    i8 = -8;
+    i16 = -16;
+}
+
+ZTEST(thingset_txt, test_update_number_formats)
+{
+    /* leading zeros are not interpreted as octal number (as done by strtol before) */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU16\":010,\"wI32\":-010}", ":84");
+    zassert_equal(10, u16);
+    zassert_equal(-10, i32);
+
+    /* hexadecimal integers are accepted, but have to be in the range of the type */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU8\":0x1F,\"wU32\":0xFFFFFFFF}", ":84");
+    zassert_equal(31, u8);
+    zassert_equal(UINT32_MAX, u32);
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wI32\":0xFFFFFFFF}", ":AF");
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU8\":0x}", ":AF");
+    zassert_equal(-10, i32);
+
+    /* negative values for unsigned types are rejected instead of wrapping around */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU32\":-1}", ":AF");
+    zassert_equal(UINT32_MAX, u32);
+
+    /* trailing characters are not ignored anymore */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wU16\":12abc}", ":AF");
+    zassert_equal(10, u16);
+
+    u8 = 8;
+    u16 = 16;
+    u32 = 32;
+    i32 = -32;
+}
+
+#if CONFIG_THINGSET_DECFRAC_TYPE_SUPPORT
+
+ZTEST(thingset_txt, test_update_decfrac)
+{
+    /* decimal input is scaled to the mantissa without conversion to float */
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wDecFrac\":21474836.47}", ":84");
+    zassert_equal(2147483647, decfrac);
+
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wDecFrac\":-12e-2}", ":84");
+    zassert_equal(-12, decfrac);
+
+    THINGSET_ASSERT_REQUEST_TXT("=Types {\"wDecFrac\":21474836.48}", ":AF");
+    zassert_equal(-12, decfrac);
+
+    decfrac = -32;
+}
+
+#endif
+
 #if CONFIG_THINGSET_BYTES_TYPE_SUPPORT
 
 ZTEST(thingset_txt, test_update_bytes_buffer)
@@ -597,6 +744,50 @@ ZTEST(thingset_txt, test_export_subset)
     THINGSET_ASSERT_EXPORT_TXT(SUBSET_LIVE, rsp_exp, strlen(rsp_exp));
 }
 
+ZTEST(thingset_txt, test_export_subsets_progressively)
+{
+    const char data_exp[] =
+        "{"
+        "\"t_s\":1000,"
+        "\"Types\":{\"wBool\":true},"
+        "\"Records\":2,"
+        "\"Nested\":{\"rBeginning\":1,\"Obj2\":{\"rItem2_V\":2.2}}"
+        "}";
+    char data_act[sizeof(data_exp)];
+    uint8_t buf[128];
+    size_t buf_size;
+    unsigned int index;
+    size_t len;
+    int ret;
+
+    /* reduce the buffer size until a single member does not fit anymore, so that the chunks end
+     * at all possible positions within the nested objects */
+    for (buf_size = sizeof(buf); buf_size > 0; buf_size--) {
+        size_t pos = 0;
+        index = 0;
+        do {
+            ret = thingset_export_subsets_progressively(&ts, buf, buf_size, SUBSET_LIVE,
+                                                        THINGSET_TXT_NAMES_VALUES, &index, &len);
+            if (ret < 0) {
+                break;
+            }
+            zassert_true(pos + len <= sizeof(data_act), "buf_size: %zu", buf_size);
+            memcpy(data_act + pos, buf, len);
+            pos += len;
+        } while (ret != 0);
+
+        if (ret == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            break;
+        }
+        zassert_equal(0, ret, "buf_size: %zu, ret: %d", buf_size, ret);
+        zassert_equal(strlen(data_exp), pos, "buf_size: %zu", buf_size);
+        zassert_mem_equal(data_exp, data_act, pos, "buf_size: %zu", buf_size);
+    }
+
+    /* at least the rItem2_V member including its parent objects has to fit */
+    zassert_true(buf_size > 0 && buf_size < 32, "buf_size: %zu", buf_size);
+}
+
 ZTEST(thingset_txt, test_update_callback)
 {
     update_callback_called = false;
@@ -629,6 +820,177 @@ ZTEST(thingset_txt, test_auth)
     thingset_set_authentication(&ts, THINGSET_USR_MASK);
 }
 
+#ifdef CONFIG_THINGSET_IMPORT_SOURCE
+
+ZTEST(thingset_txt, test_import_data_from_source)
+{
+    const char data[] =
+        "{ \"t_s\": 1001,"
+        "\"Types\":{\"wBool\":false,\"wString\":\"a, {b}\\\"\",\"wU32\":123},"
+        "\"Unknown\":{\"foo\":[1,2,3]},"
+        "\"Types/wI16\":-5,"
+        "\"Nested\":{\"Obj2\":{\"rItem2_V\":5.5},\"rEnd\":4}"
+        "}";
+    struct test_source_data src = { (const uint8_t *)data, strlen(data), 0, 5 };
+    uint8_t window[32];
+    struct thingset_source source = { window, sizeof(window), test_source_read, &src };
+    int err;
+
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_TXT_NAMES_VALUES);
+    zassert_equal(0, err, "err: 0x%X", -err);
+    zassert_equal(1001, timestamp);
+    zassert_equal(false, b);
+    zassert_mem_equal("a, {b}\"", strbuf, sizeof("a, {b}\""));
+    zassert_equal(123, u32);
+    zassert_equal(-5, i16);
+    THINGSET_ASSERT_REQUEST_TXT("?Nested/Obj2/rItem2_V", ":85 5.5");
+    THINGSET_ASSERT_REQUEST_TXT("?Nested/rEnd", ":85 4");
+
+    /* reset to default values */
+    timestamp = 1000;
+    b = true;
+    strcpy(strbuf, "string");
+    u32 = 32;
+    i16 = -16;
+    THINGSET_ASSERT_REQUEST_TXT("=Nested/Obj2 {\"rItem2_V\":2.2}", ":84");
+    THINGSET_ASSERT_REQUEST_TXT("=Nested {\"rEnd\":3}", ":84");
+}
+
+ZTEST(thingset_txt, test_import_data_from_source_invalid)
+{
+    const char data[] = "{\"Types\":{\"wString\":\"longer than the window\"}}";
+    struct test_source_data src = { (const uint8_t *)data, strlen(data), 0, 5 };
+    uint8_t window[16];
+    struct thingset_source source = { window, sizeof(window), test_source_read, &src };
+    int err;
+
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_TXT_NAMES_VALUES);
+    zassert_equal(-THINGSET_ERR_REQUEST_TOO_LARGE, err, "err: 0x%X", -err);
+
+    /* truncated data */
+    src.pos = 0;
+    src.len = 12;
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_TXT_NAMES_VALUES);
+    zassert_equal(-THINGSET_ERR_BAD_REQUEST, err, "err: 0x%X", -err);
+
+    zassert_mem_equal("string", strbuf, sizeof("string"));
+
+    /* empty key is ignored like unknown data objects */
+    const char data_empty_key[] = "{\"\":{\"t_s\":5},\"\":6}";
+    src.data = (const uint8_t *)data_empty_key;
+    src.len = strlen(data_empty_key);
+    src.pos = 0;
+    err = thingset_import_data_from_source(&ts, &source, THINGSET_WRITE_MASK,
+                                           THINGSET_TXT_NAMES_VALUES);
+    zassert_equal(0, err, "err: 0x%X", -err);
+    zassert_equal(1000, timestamp);
+}
+
+#endif /* CONFIG_THINGSET_IMPORT_SOURCE */
+
+#ifdef CONFIG_THINGSET_RESPONSE_CONTINUATION
+
+/*
+ * Process the request with decreasing response buffer sizes, so that the response is split at all
+ * possible positions, and compare the concatenated pieces with the complete response.
+ *
+ * @returns Smallest buffer size the response could be retrieved with
+ */
+static size_t assert_request_continued(const char *req)
+{
+    char rsp_exp[THINGSET_TEST_BUF_SIZE];
+    char rsp_act[THINGSET_TEST_BUF_SIZE];
+    char buf[THINGSET_TEST_BUF_SIZE];
+    size_t buf_size;
+    int len;
+
+    len = thingset_process_message(&ts, req, strlen(req), rsp_exp, sizeof(rsp_exp));
+    zassert_true(len > 0);
+    zassert_mem_equal(":85", rsp_exp, 3, "rsp: %s", rsp_exp);
+    zassert_false(thingset_response_continued(&ts));
+
+    for (buf_size = len; buf_size >= 4; buf_size--) {
+        size_t pos = 0;
+        len = thingset_process_message(&ts, req, strlen(req), buf, buf_size);
+        if (strncmp(buf, ":85", 3) != 0) {
+            /* the first element does not fit anymore */
+            zassert_mem_equal(":E1", buf, 3, "buf_size: %zu", buf_size);
+            break;
+        }
+
+        while (len > 0) {
+            zassert_true(pos + len < sizeof(rsp_act));
+            zassert_equal('\0', buf[len], "buf_size: %zu", buf_size);
+            memcpy(rsp_act + pos, buf, len);
+            pos += len;
+            len = thingset_process_continue(&ts, buf, buf_size);
+        }
+
+        if (len == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            /* a later element does not fit anymore */
+            break;
+        }
+        zassert_equal(0, len, "buf_size: %zu, len: %d", buf_size, len);
+        zassert_false(thingset_response_continued(&ts));
+        zassert_equal(strlen(rsp_exp), pos, "buf_size: %zu", buf_size);
+        zassert_mem_equal(rsp_exp, rsp_act, pos, "buf_size: %zu", buf_size);
+    }
+
+    return buf_size + 1;
+}
+
+ZTEST(thingset_txt, test_get_continued)
+{
+    zassert_true(assert_request_continued("?Arrays") < 40);
+    zassert_true(assert_request_continued("?Nested") < 24);
+
+    /* strings have to fit into the buffer with their maximum length */
+    zassert_true(assert_request_continued("?Records/1") < 200);
+}
+
+ZTEST(thingset_txt, test_fetch_continued)
+{
+    zassert_true(assert_request_continued("?Types null") < 16);
+    zassert_true(assert_request_continued("?Types [\"wF32\",\"wBool\",\"wU32\",\"wI64\"]") < 16);
+    zassert_true(assert_request_continued("?_Metadata [\"Types/wBool\",\"Arrays/wF32\"]") < 48);
+}
+
+ZTEST(thingset_txt, test_fetch_continued_error)
+{
+    const char req[] = "?Types [\"wF32\",\"wBool\",\"wU32\",\"rUnknown\"]";
+    char buf[20];
+    int len;
+
+    /* the request is checked completely before the first piece is returned */
+    len = thingset_process_message(&ts, req, strlen(req), buf, sizeof(buf));
+    zassert_true(len > 0);
+    zassert_mem_equal(":A4", buf, 3, "rsp: %s", buf);
+    zassert_false(thingset_response_continued(&ts));
+}
+
+ZTEST(thingset_txt, test_process_continue_discarded)
+{
+    const char req[] = "?Types";
+    char buf[32];
+    int len;
+
+    len = thingset_process_message(&ts, req, strlen(req), buf, sizeof(buf));
+    zassert_true(len > 0);
+    zassert_true(thingset_response_continued(&ts));
+
+    /* new request discards the remaining pieces of the previous response */
+    THINGSET_ASSERT_REQUEST_TXT("?Types/wBool", ":85 true");
+    zassert_false(thingset_response_continued(&ts));
+
+    len = thingset_process_continue(&ts, buf, sizeof(buf));
+    zassert_equal(0, len);
+}
+
+#endif /* CONFIG_THINGSET_RESPONSE_CONTINUATION */
+
 ZTEST(thingset_txt, test_import_record)
 {
     struct thingset_endpoint endpoint;
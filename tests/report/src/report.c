@@ -8,6 +8,9 @@
 
 #include <thingset.h>
 
+#include <float.h>
+
+#include "../../src/thingset_internal.h"
 #include "data.h"
 #include "test_utils.h"
 
@@ -140,10 +143,679 @@ ZTEST(thingset_report, test_report_txt)
     THINGSET_ASSERT_REPORT_TXT("mLive", rpt_exp, strlen(rpt_exp));
 }
 
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+static void assert_report_template(struct thingset_report_template *tmpl, const char *path,
+                                   enum thingset_data_format format)
+{
+    uint8_t rpt_exp[THINGSET_TEST_BUF_SIZE];
+    uint8_t rpt_act[THINGSET_TEST_BUF_SIZE];
+
+    int len_exp = thingset_report_path(&ts, rpt_exp, sizeof(rpt_exp), path, format);
+    zassert_true(len_exp > 0, "len_exp: %d", len_exp);
+
+    int len_act = thingset_report_render(tmpl, rpt_act, sizeof(rpt_act));
+    zassert_equal(len_exp, len_act, "act: %d, exp: %d", len_act, len_exp);
+    zassert_mem_equal(rpt_exp, rpt_act, len_exp);
+
+    /* buffer too small for the header */
+    len_act = thingset_report_render(tmpl, rpt_act, 4);
+    zassert_equal(-THINGSET_ERR_RESPONSE_TOO_LARGE, len_act, "act: %d", len_act);
+}
+
+ZTEST(thingset_report, test_report_template_txt)
+{
+    struct thingset_report_template tmpl;
+
+    int err = thingset_report_prepare(&ts, "mLive", THINGSET_TXT_NAMES_VALUES, &tmpl);
+    zassert_equal(0, err, "err: %d", err);
+
+    assert_report_template(&tmpl, "mLive", THINGSET_TXT_NAMES_VALUES);
+}
+
+ZTEST(thingset_report, test_report_template_bin_ids)
+{
+    struct thingset_report_template tmpl;
+
+    int err = thingset_report_prepare(&ts, "mLive", THINGSET_BIN_IDS_VALUES, &tmpl);
+    zassert_equal(0, err, "err: %d", err);
+
+    assert_report_template(&tmpl, "mLive", THINGSET_BIN_IDS_VALUES);
+}
+
+ZTEST(thingset_report, test_report_template_bin_names)
+{
+    struct thingset_report_template tmpl;
+
+    int err = thingset_report_prepare(&ts, "mLive", THINGSET_BIN_NAMES_VALUES, &tmpl);
+    zassert_equal(0, err, "err: %d", err);
+
+    assert_report_template(&tmpl, "mLive", THINGSET_BIN_NAMES_VALUES);
+}
+
+ZTEST(thingset_report, test_report_template_subset_change)
+{
+    struct thingset_report_template tmpl_txt;
+    struct thingset_report_template tmpl_bin;
+
+    zassert_equal(0, thingset_report_prepare(&ts, "mLive", THINGSET_TXT_NAMES_VALUES, &tmpl_txt));
+    zassert_equal(0, thingset_report_prepare(&ts, "mLive", THINGSET_BIN_IDS_VALUES, &tmpl_bin));
+
+    /* add a member with a different parent */
+    struct thingset_data_object *object = thingset_get_object_by_id(&ts, 0x502);
+    zassert_not_null(object);
+    uint32_t subsets = object->subsets;
+
+    thingset_set_object_subsets(&ts, object, subsets | SUBSET_LIVE);
+    assert_report_template(&tmpl_txt, "mLive", THINGSET_TXT_NAMES_VALUES);
+    assert_report_template(&tmpl_bin, "mLive", THINGSET_BIN_IDS_VALUES);
+
+    thingset_set_object_subsets(&ts, object, subsets);
+    assert_report_template(&tmpl_txt, "mLive", THINGSET_TXT_NAMES_VALUES);
+    assert_report_template(&tmpl_bin, "mLive", THINGSET_BIN_IDS_VALUES);
+}
+
+ZTEST(thingset_report, test_report_template_invalid)
+{
+    struct thingset_report_template tmpl;
+
+    int err = thingset_report_prepare(&ts, "Types", THINGSET_BIN_IDS_VALUES, &tmpl);
+    zassert_equal(-THINGSET_ERR_BAD_REQUEST, err, "err: %d", err);
+
+    err = thingset_report_prepare(&ts, "mInvalid", THINGSET_BIN_IDS_VALUES, &tmpl);
+    zassert_equal(-THINGSET_ERR_NOT_FOUND, err, "err: %d", err);
+}
+
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+
+static struct thingset_context ts_fixed;
+
+static uint8_t fixed_u8 = 8;
+static int16_t fixed_i16 = -16;
+static float fixed_f32 = 1.5F;
+static bool fixed_bool = true;
+static int32_t fixed_decfrac = 123;
+static uint64_t fixed_u64 = 64;
+
+static struct thingset_data_object fixed_objects[] = {
+    THINGSET_ITEM_UINT8(THINGSET_ID_ROOT, 0x901, "rU8", &fixed_u8, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_INT16(THINGSET_ID_ROOT, 0x902, "rI16", &fixed_i16, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_FLOAT(THINGSET_ID_ROOT, 0x903, "rF32", &fixed_f32, 0, THINGSET_ANY_R,
+                        SUBSET_LIVE),
+    THINGSET_ITEM_BOOL(THINGSET_ID_ROOT, 0x904, "rBool", &fixed_bool, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_DECFRAC(THINGSET_ID_ROOT, 0x905, "rDecFrac", &fixed_decfrac, 2, THINGSET_ANY_R,
+                          SUBSET_LIVE),
+    THINGSET_ITEM_UINT64(THINGSET_ID_ROOT, 0x906, "rU64", &fixed_u64, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_SUBSET(THINGSET_ID_ROOT, 0x900, "mFixed", SUBSET_LIVE, THINGSET_ANY_RW),
+};
+
+ZTEST(thingset_report, test_report_fixed_width)
+{
+    uint8_t rsp_act[100];
+
+    char rsp_exp_hex[] =
+        "1f "                                   /* report, binary */
+        "19 09 00 "                             /* mFixed 0x900 */
+        "a6 "                                   /* map with 6 elements */
+        "19 09 01 1a 00 00 00 08 "              /* rU8: 8 */
+        "19 09 02 3a 00 00 00 0f "              /* rI16: -16 */
+        "19 09 03 fa 3f c0 00 00 "              /* rF32: 1.5 (float despite 0 decimals) */
+        "19 09 04 f5 "                          /* rBool: true */
+        "19 09 05 c4 82 21 1a 00 00 00 7b "     /* rDecFrac: 4([-2, 123]) */
+        "19 09 06 1b 00 00 00 00 00 00 00 40 "; /* rU64: 64 */
+    uint8_t rsp_exp[sizeof(rsp_exp_hex) / 3];
+    hex2bin_spaced(rsp_exp_hex, rsp_exp, sizeof(rsp_exp));
+
+    int len = thingset_report_path(&ts_fixed, rsp_act, sizeof(rsp_act), "mFixed",
+                                   THINGSET_BIN_IDS_VALUES_FIXED_WIDTH);
+    zassert_equal(sizeof(rsp_exp), len, "len: %d", len);
+
+    char rsp_act_hex[len * 3];
+    bin2hex_spaced(rsp_act, len, rsp_act_hex, sizeof(rsp_act_hex));
+    zassert_mem_equal(rsp_exp, rsp_act, sizeof(rsp_exp), "rsp_act: %s\nrsp_exp: %s\n", rsp_act_hex,
+                      rsp_exp_hex);
+}
+
+#ifdef CONFIG_THINGSET_REPORT_TEMPLATES
+
+ZTEST(thingset_report, test_report_patch)
+{
+    struct thingset_report_template tmpl;
+    uint8_t rsp_exp[100];
+    uint8_t rsp_act[100];
+    int len_exp;
+    int len_act;
+
+    int err = thingset_report_prepare(&ts_fixed, "mFixed", THINGSET_BIN_IDS_VALUES_FIXED_WIDTH,
+                                      &tmpl);
+    zassert_equal(0, err, "err: %d", err);
+
+    len_act = thingset_report_render(&tmpl, rsp_act, sizeof(rsp_act));
+    zassert_true(len_act > 0, "len_act: %d", len_act);
+
+    fixed_u8 = 255;
+    fixed_i16 = 1000;
+    fixed_f32 = -2.25F;
+    fixed_bool = false;
+    fixed_decfrac = -100000;
+    fixed_u64 = UINT64_MAX;
+
+    len_exp = thingset_report_path(&ts_fixed, rsp_exp, sizeof(rsp_exp), "mFixed",
+                                   THINGSET_BIN_IDS_VALUES_FIXED_WIDTH);
+    len_act = thingset_report_patch(&tmpl, rsp_act, sizeof(rsp_act));
+    zassert_equal(len_exp, len_act, "act: %d, exp: %d", len_act, len_exp);
+    zassert_mem_equal(rsp_exp, rsp_act, len_exp);
+
+    /* changed subset requires rendering the entire report again */
+    thingset_set_object_subsets(&ts_fixed, &fixed_objects[1], 0);
+
+    len_exp = thingset_report_path(&ts_fixed, rsp_exp, sizeof(rsp_exp), "mFixed",
+                                   THINGSET_BIN_IDS_VALUES_FIXED_WIDTH);
+    len_act = thingset_report_patch(&tmpl, rsp_act, sizeof(rsp_act));
+    zassert_equal(len_exp, len_act, "act: %d, exp: %d", len_act, len_exp);
+    zassert_mem_equal(rsp_exp, rsp_act, len_exp);
+
+    thingset_set_object_subsets(&ts_fixed, &fixed_objects[1], SUBSET_LIVE);
+}
+
+ZTEST(thingset_report, test_report_patch_unsupported)
+{
+    struct thingset_report_template tmpl;
+    uint8_t rsp[THINGSET_TEST_BUF_SIZE];
+
+    /* variable-width values */
+    zassert_equal(0, thingset_report_prepare(&ts, "mLive", THINGSET_BIN_IDS_VALUES_FIXED_WIDTH,
+                                             &tmpl));
+    zassert_true(thingset_report_render(&tmpl, rsp, sizeof(rsp)) > 0);
+    zassert_equal(-THINGSET_ERR_UNSUPPORTED_FORMAT,
+                  thingset_report_patch(&tmpl, rsp, sizeof(rsp)));
+
+    /* format without fixed positions */
+    zassert_equal(0, thingset_report_prepare(&ts_fixed, "mFixed", THINGSET_BIN_IDS_VALUES, &tmpl));
+    zassert_equal(-THINGSET_ERR_UNSUPPORTED_FORMAT,
+                  thingset_report_patch(&tmpl, rsp, sizeof(rsp)));
+}
+
+#endif /* CONFIG_THINGSET_REPORT_TEMPLATES */
+
+#endif /* CONFIG_THINGSET_REPORT_FIXED_WIDTH */
+
+#ifdef CONFIG_THINGSET_CHANGE_TRACKING
+
+ZTEST(thingset_report, test_report_changes)
+{
+    uint8_t rpt_exp[THINGSET_TEST_BUF_SIZE];
+    uint8_t rpt_act[THINGSET_TEST_BUF_SIZE];
+    uint32_t version = 0;
+    int len_exp;
+    int len_act;
+
+    /* version 0 results in a full report */
+    len_exp = thingset_report_path(&ts, rpt_exp, sizeof(rpt_exp), "mLive", THINGSET_BIN_IDS_VALUES);
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(len_exp, len_act, "act: %d, exp: %d", len_act, len_exp);
+    zassert_mem_equal(rpt_exp, rpt_act, len_exp);
+    zassert_equal(thingset_get_data_version(&ts), version);
+
+    /* nothing changed */
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(0, len_act, "act: %d", len_act);
+
+    /* same value does not result in a change */
+    uint32_t value = timestamp;
+    zassert_equal(0, thingset_set_value(&ts, 0x10, &value));
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(0, len_act, "act: %d", len_act);
+
+    value = timestamp + 1;
+    zassert_equal(0, thingset_set_value(&ts, 0x10, &value));
+
+    char rpt_exp_hex[] = "1f 19 08 00 a1 10 19 03 e9"; /* mLive: {t_s: 1001} */
+    len_exp = hex2bin_spaced(rpt_exp_hex, rpt_exp, sizeof(rpt_exp));
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(len_exp, len_act, "act: %d, exp: %d", len_act, len_exp);
+    zassert_mem_equal(rpt_exp, rpt_act, len_exp);
+
+    value = timestamp - 1;
+    zassert_equal(0, thingset_set_value(&ts, 0x10, &value));
+    zassert_equal(0, thingset_mark_changed(&ts, 0x201));
+
+    const char rpt_exp_txt[] = "#mLive {\"t_s\":1000,\"Types\":{\"wBool\":true}}";
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_TXT_NAMES_VALUES, &version);
+    zassert_equal(strlen(rpt_exp_txt), len_act, "act: %d", len_act);
+    zassert_mem_equal(rpt_exp_txt, rpt_act, len_act, "act: %s", rpt_act);
+
+    /* changes via the protocol */
+    const char req[] = "=Types {\"wBool\":true}";
+    len_act = thingset_process_message(&ts, req, strlen(req), rpt_act, sizeof(rpt_act));
+    zassert_true(len_act > 0);
+
+    const char rpt_exp_txt2[] = "#mLive {\"Types\":{\"wBool\":true}}";
+    len_act = thingset_report_path_changes(&ts, rpt_act, sizeof(rpt_act), "mLive",
+                                           THINGSET_TXT_NAMES_VALUES, &version);
+    zassert_equal(strlen(rpt_exp_txt2), len_act, "act: %d", len_act);
+    zassert_mem_equal(rpt_exp_txt2, rpt_act, len_act, "act: %s", rpt_act);
+}
+
+ZTEST(thingset_report, test_report_changes_invalid)
+{
+    uint8_t rpt[THINGSET_TEST_BUF_SIZE];
+    uint32_t version = 0;
+
+    zassert_equal(-THINGSET_ERR_BAD_REQUEST,
+                  thingset_report_path_changes(&ts, rpt, sizeof(rpt), "Types",
+                                               THINGSET_BIN_IDS_VALUES, &version));
+    zassert_equal(0, version);
+
+    zassert_equal(-THINGSET_ERR_NOT_FOUND, thingset_mark_changed(&ts, 0xFFFF));
+    zassert_equal(-THINGSET_ERR_NOT_FOUND, thingset_set_value(&ts, 0xFFFF, &version));
+    zassert_equal(-THINGSET_ERR_UNSUPPORTED_FORMAT, thingset_set_value(&ts, 0x200, &version));
+}
+
+ZTEST(thingset_report, test_export_changes)
+{
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    uint32_t version = 0;
+    int len;
+
+    len = thingset_export_subsets_changes(&ts, data, sizeof(data), SUBSET_LIVE,
+                                          THINGSET_BIN_IDS_VALUES, &version);
+    zassert_true(len > 0, "len: %d", len);
+
+    len = thingset_export_subsets_changes(&ts, data, sizeof(data), SUBSET_LIVE,
+                                          THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(0, len, "len: %d", len);
+
+    zassert_equal(0, thingset_mark_changed(&ts, 0x10));
+
+    char data_exp_hex[] = "a1 10 19 03 e8"; /* {t_s: 1000} */
+    uint8_t data_exp[sizeof(data_exp_hex) / 3];
+    hex2bin_spaced(data_exp_hex, data_exp, sizeof(data_exp));
+
+    len = thingset_export_subsets_changes(&ts, data, sizeof(data), SUBSET_LIVE,
+                                          THINGSET_BIN_IDS_VALUES, &version);
+    zassert_equal(sizeof(data_exp), len, "len: %d", len);
+    zassert_mem_equal(data_exp, data, len);
+}
+
+#endif /* CONFIG_THINGSET_CHANGE_TRACKING */
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+
+struct sink_output
+{
+    uint8_t data[THINGSET_TEST_BUF_SIZE];
+    size_t len;
+    unsigned int num_flushes;
+};
+
+static int sink_collect(const uint8_t *data, size_t len, void *user_data)
+{
+    struct sink_output *out = user_data;
+
+    zassert_true(out->len + len <= sizeof(out->data));
+    memcpy(out->data + out->len, data, len);
+    out->len += len;
+    out->num_flushes++;
+
+    return 0;
+}
+
+static int sink_abort(const uint8_t *data, size_t len, void *user_data)
+{
+    return -EIO;
+}
+
+static struct thingset_context ts_sink;
+
+static uint32_t sink_u32 = 32;
+static float sink_f32 = 3.2F;
+static bool sink_bool = true;
+static int16_t sink_i16 = -16;
+static uint8_t sink_u8 = 8;
+
+/* nested groups to check closing of JSON objects after flushing */
+static struct thingset_data_object sink_objects[] = {
+    THINGSET_ITEM_UINT32(THINGSET_ID_ROOT, 0xA01, "rU32", &sink_u32, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_GROUP(THINGSET_ID_ROOT, 0xA02, "Group", THINGSET_NO_CALLBACK),
+    THINGSET_ITEM_FLOAT(0xA02, 0xA03, "rF32", &sink_f32, 1, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_GROUP(0xA02, 0xA04, "Nested", THINGSET_NO_CALLBACK),
+    THINGSET_ITEM_BOOL(0xA04, 0xA05, "rBool", &sink_bool, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_INT16(0xA02, 0xA06, "rI16", &sink_i16, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_UINT8(THINGSET_ID_ROOT, 0xA07, "rU8", &sink_u8, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_SUBSET(THINGSET_ID_ROOT, 0xA08, "mSink", SUBSET_LIVE, THINGSET_ANY_R),
+};
+
+/*
+ * Stream the report or export through staging buffers of decreasing size until a single subset
+ * member does not fit anymore and compare the result with the data in a single buffer.
+ *
+ * Returns the maximum number of flushes.
+ */
+static unsigned int assert_sink(struct thingset_context *ts, const char *path,
+                                enum thingset_data_format format)
+{
+    uint8_t exp[THINGSET_TEST_BUF_SIZE];
+    uint8_t staging[THINGSET_TEST_BUF_SIZE];
+    struct sink_output out;
+    struct thingset_sink sink = {
+        .buf = staging,
+        .flush = sink_collect,
+        .user_data = &out,
+    };
+    unsigned int max_flushes = 0;
+    int exp_len;
+    int ret;
+
+    if (path != NULL) {
+        exp_len = thingset_report_path(ts, (char *)exp, sizeof(exp), path, format);
+    }
+    else {
+        exp_len = thingset_export_subsets(ts, exp, sizeof(exp), SUBSET_LIVE, format);
+    }
+    zassert_true(exp_len > 0, "exp_len: %d", exp_len);
+
+    for (sink.size = sizeof(staging); sink.size > 0; sink.size--) {
+        memset(&out, 0, sizeof(out));
+        if (path != NULL) {
+            ret = thingset_report_path_to_sink(ts, &sink, path, format);
+        }
+        else {
+            ret = thingset_export_subsets_to_sink(ts, &sink, SUBSET_LIVE, format);
+        }
+
+        if (ret == -THINGSET_ERR_RESPONSE_TOO_LARGE) {
+            break;
+        }
+        zassert_equal(exp_len, ret, "size: %zu, act: %d, exp: %d", sink.size, ret, exp_len);
+        zassert_equal(exp_len, out.len);
+        zassert_mem_equal(exp, out.data, exp_len, "size: %zu", sink.size);
+        max_flushes = MAX(max_flushes, out.num_flushes);
+    }
+
+    return max_flushes;
+}
+
+ZTEST(thingset_report, test_report_sink_txt)
+{
+    zassert_true(assert_sink(&ts_sink, "mSink", THINGSET_TXT_NAMES_VALUES) > 3);
+    zassert_true(assert_sink(&ts, "mLive", THINGSET_TXT_NAMES_VALUES) > 1);
+}
+
+ZTEST(thingset_report, test_report_sink_bin)
+{
+    zassert_true(assert_sink(&ts_sink, "mSink", THINGSET_BIN_IDS_VALUES) > 3);
+    zassert_true(assert_sink(&ts_sink, "mSink", THINGSET_BIN_NAMES_VALUES) > 3);
+    zassert_true(assert_sink(&ts, "mLive", THINGSET_BIN_IDS_VALUES) > 1);
+}
+
+ZTEST(thingset_report, test_export_sink)
+{
+    zassert_true(assert_sink(&ts_sink, NULL, THINGSET_TXT_NAMES_VALUES) > 3);
+    zassert_true(assert_sink(&ts_sink, NULL, THINGSET_BIN_IDS_VALUES) > 3);
+    zassert_true(assert_sink(&ts, NULL, THINGSET_BIN_IDS_VALUES) > 1);
+}
+
+ZTEST(thingset_report, test_sink_abort)
+{
+    uint8_t staging[24];
+    struct thingset_sink sink = {
+        .buf = staging,
+        .size = sizeof(staging),
+        .flush = sink_abort,
+    };
+
+    zassert_equal(-EIO, thingset_report_path_to_sink(&ts_sink, &sink, "mSink",
+                                                     THINGSET_BIN_IDS_VALUES));
+    zassert_equal(-EIO, thingset_export_subsets_to_sink(&ts_sink, &sink, SUBSET_LIVE,
+                                                        THINGSET_TXT_NAMES_VALUES));
+}
+
+#endif /* CONFIG_THINGSET_STREAMING_SINK */
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+
+static struct thingset_context ts_iovec;
+
+static uint32_t iovec_u32 = 32;
+static char iovec_long_str[128];
+static char iovec_short_str[16] = "short";
+static uint8_t iovec_bytes_buf[300];
+static THINGSET_DEFINE_BYTES(iovec_bytes, iovec_bytes_buf, sizeof(iovec_bytes_buf));
+static uint8_t iovec_u8 = 8;
+
+static struct thingset_data_object iovec_objects[] = {
+    THINGSET_ITEM_UINT32(THINGSET_ID_ROOT, 0xB01, "rU32", &iovec_u32, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_STRING(THINGSET_ID_ROOT, 0xB02, "rLongString", iovec_long_str,
+                         sizeof(iovec_long_str), THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_STRING(THINGSET_ID_ROOT, 0xB03, "rShortString", iovec_short_str,
+                         sizeof(iovec_short_str), THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_ITEM_BYTES(THINGSET_ID_ROOT, 0xB04, "rBytes", &iovec_bytes, THINGSET_ANY_R,
+                        SUBSET_LIVE),
+    THINGSET_ITEM_UINT8(THINGSET_ID_ROOT, 0xB05, "rU8", &iovec_u8, THINGSET_ANY_R, SUBSET_LIVE),
+    THINGSET_SUBSET(THINGSET_ID_ROOT, 0xB06, "mIovec", SUBSET_LIVE, THINGSET_ANY_R),
+};
+
+ZTEST(thingset_report, test_export_iovec)
+{
+    uint8_t exp[THINGSET_TEST_BUF_SIZE];
+    uint8_t act[THINGSET_TEST_BUF_SIZE];
+    uint8_t buf[64];
+    struct thingset_iovec iov[8];
+    size_t len = 0;
+    int exp_len;
+    int ret;
+
+    memset(iovec_long_str, 'a', 100);
+    for (size_t i = 0; i < sizeof(iovec_bytes_buf); i++) {
+        iovec_bytes_buf[i] = i;
+    }
+
+    exp_len = thingset_export_subsets(&ts_iovec, exp, sizeof(exp), SUBSET_LIVE,
+                                      THINGSET_BIN_IDS_VALUES);
+    zassert_true(exp_len > 0, "exp_len: %d", exp_len);
+
+    ret = thingset_export_subsets_iovec(&ts_iovec, buf, sizeof(buf), iov, ARRAY_SIZE(iov),
+                                        SUBSET_LIVE, THINGSET_BIN_IDS_VALUES);
+    zassert_equal(5, ret, "ret: %d", ret);
+
+    /* long string and byte string are referenced in place */
+    zassert_equal_ptr(iovec_long_str, iov[1].base);
+    zassert_equal(100, iov[1].len);
+    zassert_equal_ptr(iovec_bytes_buf, iov[3].base);
+    zassert_equal(sizeof(iovec_bytes_buf), iov[3].len);
+
+    for (int i = 0; i < ret; i++) {
+        memcpy(act + len, iov[i].base, iov[i].len);
+        len += iov[i].len;
+    }
+    zassert_equal(exp_len, len, "len: %zu, exp: %d", len, exp_len);
+    zassert_mem_equal(exp, act, exp_len);
+}
+
+ZTEST(thingset_report, test_export_iovec_invalid)
+{
+    uint8_t buf[64];
+    struct thingset_iovec iov[8];
+    int ret;
+
+    ret = thingset_export_subsets_iovec(&ts_iovec, buf, sizeof(buf), iov, 4, SUBSET_LIVE,
+                                        THINGSET_BIN_IDS_VALUES);
+    zassert_equal(-THINGSET_ERR_RESPONSE_TOO_LARGE, ret, "ret: %d", ret);
+
+    ret = thingset_export_subsets_iovec(&ts_iovec, buf, 8, iov, ARRAY_SIZE(iov), SUBSET_LIVE,
+                                        THINGSET_BIN_IDS_VALUES);
+    zassert_equal(-THINGSET_ERR_RESPONSE_TOO_LARGE, ret, "ret: %d", ret);
+
+    ret = thingset_export_subsets_iovec(&ts_iovec, buf, sizeof(buf), iov, ARRAY_SIZE(iov),
+                                        SUBSET_LIVE, THINGSET_TXT_NAMES_VALUES);
+    zassert_equal(-THINGSET_ERR_NOT_IMPLEMENTED, ret, "ret: %d", ret);
+}
+
+#endif /* CONFIG_THINGSET_EXPORT_IOVEC */
+
+#ifdef CONFIG_THINGSET_SIZE_QUERY
+
+/*
+ * Compare the length determined without storing the data with the actual length and check that
+ * buffers with the exact size and the worst-case bound (plus null-termination) are sufficient.
+ *
+ * Returns the worst-case bound.
+ */
+static int assert_size(struct thingset_context *ts, const char *path,
+                       enum thingset_data_format format)
+{
+    static uint8_t buf[8192];
+    static uint8_t exp[sizeof(buf)];
+    int size_max;
+    int size;
+    int len;
+
+    if (path != NULL) {
+        len = thingset_report_path(ts, (char *)buf, sizeof(buf), path, format);
+        size = thingset_report_size(ts, path, format);
+        size_max = thingset_report_size_max(ts, path, format);
+    }
+    else {
+        len = thingset_export_subsets(ts, buf, sizeof(buf), SUBSET_LIVE, format);
+        size = thingset_export_size(ts, SUBSET_LIVE, format);
+        size_max = thingset_export_size_max(ts, SUBSET_LIVE, format);
+    }
+    zassert_true(len > 0, "len: %d", len);
+    zassert_equal(len, size, "size: %d, exp: %d", size, len);
+    zassert_true(size_max >= len && size_max < sizeof(buf), "size_max: %d", size_max);
+    memcpy(exp, buf, len);
+
+    if (path != NULL) {
+        len = thingset_report_path(ts, (char *)buf, size + 1, path, format);
+    }
+    else {
+        len = thingset_export_subsets(ts, buf, size + 1, SUBSET_LIVE, format);
+    }
+    zassert_equal(size, len, "len: %d", len);
+    zassert_mem_equal(exp, buf, len);
+
+    if (path != NULL) {
+        len = thingset_report_path(ts, (char *)buf, size_max + 1, path, format);
+    }
+    else {
+        len = thingset_export_subsets(ts, buf, size_max + 1, SUBSET_LIVE, format);
+    }
+    zassert_equal(size, len, "len: %d", len);
+
+    return size_max;
+}
+
+ZTEST(thingset_report, test_report_size)
+{
+    assert_size(&ts_sink, "mSink", THINGSET_TXT_NAMES_VALUES);
+    assert_size(&ts_sink, "mSink", THINGSET_BIN_IDS_VALUES);
+    assert_size(&ts_sink, "mSink", THINGSET_BIN_NAMES_VALUES);
+    assert_size(&ts_sink, "Group", THINGSET_TXT_NAMES_VALUES);
+    assert_size(&ts_sink, "Group", THINGSET_BIN_NAMES_VALUES);
+    assert_size(&ts_sink, "Group/rF32", THINGSET_TXT_NAMES_VALUES);
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    assert_size(&ts_fixed, "mFixed", THINGSET_TXT_NAMES_VALUES);
+    assert_size(&ts_fixed, "mFixed", THINGSET_BIN_IDS_VALUES_FIXED_WIDTH);
+#endif
+    assert_size(&ts, "mLive", THINGSET_TXT_NAMES_VALUES);
+    assert_size(&ts, "mLive", THINGSET_BIN_IDS_VALUES);
+}
+
+ZTEST(thingset_report, test_report_size_groups_records)
+{
+    const char *paths[] = { "Types", "Exec", "Access", "Nested", "Records", "Records/1" };
+    const enum thingset_data_format formats[] = {
+        THINGSET_TXT_NAMES_VALUES,
+        THINGSET_BIN_IDS_VALUES,
+        THINGSET_BIN_NAMES_VALUES,
+    };
+
+    for (int i = 0; i < ARRAY_SIZE(paths); i++) {
+        for (int j = 0; j < ARRAY_SIZE(formats); j++) {
+            assert_size(&ts, paths[i], formats[j]);
+        }
+    }
+
+    /* not limited by the size of a staging buffer, as the data is not serialized */
+    zassert_true(thingset_report_size(&ts, "Records", THINGSET_TXT_NAMES_VALUES) > 256);
+}
+
+ZTEST(thingset_report, test_export_size)
+{
+    assert_size(&ts_sink, NULL, THINGSET_TXT_NAMES_VALUES);
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    assert_size(&ts_iovec, NULL, THINGSET_TXT_NAMES_VALUES);
+#endif
+    assert_size(&ts, NULL, THINGSET_TXT_NAMES_VALUES);
+
+    /* map header reserved for up to 255 members, 5 keys with 3 bytes and the values */
+    zassert_equal(2 + 5 * 3 + 5 + 5 + 1 + 3 + 2, assert_size(&ts_sink, NULL,
+                                                             THINGSET_BIN_IDS_VALUES));
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    assert_size(&ts_iovec, NULL, THINGSET_BIN_IDS_VALUES);
+#endif
+    assert_size(&ts, NULL, THINGSET_BIN_IDS_VALUES);
+}
+
+ZTEST(thingset_report, test_size_max_extreme_values)
+{
+    uint32_t u32 = sink_u32;
+    float f32 = sink_f32;
+    int16_t i16 = sink_i16;
+    uint8_t u8 = sink_u8;
+
+    sink_u32 = UINT32_MAX;
+    sink_f32 = -FLT_MAX;
+    sink_i16 = INT16_MIN;
+    sink_u8 = UINT8_MAX;
+
+    assert_size(&ts_sink, "mSink", THINGSET_TXT_NAMES_VALUES);
+    assert_size(&ts_sink, "mSink", THINGSET_BIN_IDS_VALUES);
+
+    sink_u32 = u32;
+    sink_f32 = f32;
+    sink_i16 = i16;
+    sink_u8 = u8;
+}
+
+ZTEST(thingset_report, test_size_invalid)
+{
+    zassert_equal(-THINGSET_ERR_NOT_FOUND,
+                  thingset_report_size_max(&ts_sink, "Unknown", THINGSET_TXT_NAMES_VALUES));
+    zassert_equal(-THINGSET_ERR_NOT_IMPLEMENTED,
+                  thingset_export_size_max(&ts_sink, SUBSET_LIVE, THINGSET_BIN_NAMES_VALUES));
+    zassert_equal(-THINGSET_ERR_NOT_IMPLEMENTED,
+                  thingset_export_size(&ts_sink, SUBSET_LIVE, THINGSET_BIN_NAMES_VALUES));
+    zassert_equal(-THINGSET_ERR_NOT_FOUND,
+                  thingset_report_size(&ts, "Records/9", THINGSET_TXT_NAMES_VALUES));
+}
+
+#endif /* CONFIG_THINGSET_SIZE_QUERY */
+
 static void *thingset_setup(void)
 {
     thingset_init_global(&ts);
 
+#ifdef CONFIG_THINGSET_REPORT_FIXED_WIDTH
+    thingset_init(&ts_fixed, fixed_objects, ARRAY_SIZE(fixed_objects));
+#endif
+
+#ifdef CONFIG_THINGSET_STREAMING_SINK
+    thingset_init(&ts_sink, sink_objects, ARRAY_SIZE(sink_objects));
+#endif
+
+#ifdef CONFIG_THINGSET_EXPORT_IOVEC
+    thingset_init(&ts_iovec, iovec_objects, ARRAY_SIZE(iovec_objects));
+#endif
+
     return NULL;
 }
 